@@ -0,0 +1,35 @@
+# Find liburing library and header file
+# Sets
+#   LIBURING_FOUND         to 0 or 1 depending on result
+#   LIBURING_INCLUDE_DIRS  to the directory containing liburing.h
+#   LIBURING_LIBRARIES     to the liburing library
+# If LIBURING_REQUIRED is defined, then a fatal error message will be generated if liburing is not found
+if( NOT LIBURING_INCLUDE_DIRS OR NOT LIBURING_LIBRARIES )
+  find_library( LIBURING_LIBRARY
+    NAMES uring liburing
+    DOC "Location of liburing library"
+  )
+
+  find_path( LIBURING_HEADER_DIR
+    NAMES liburing.h
+    DOC "Path to liburing.h header file"
+  )
+
+  if( LIBURING_HEADER_DIR AND LIBURING_LIBRARY )
+    set( LIBURING_FOUND TRUE CACHE BOOL "liburing found" FORCE )
+    set( LIBURING_INCLUDE_DIRS "${LIBURING_HEADER_DIR}" CACHE STRING "Include directories for liburing" FORCE )
+    set( LIBURING_LIBRARIES "${LIBURING_LIBRARY}" CACHE STRING "Link libraries for liburing" FORCE )
+
+    mark_as_advanced( LIBURING_INCLUDE_DIRS LIBURING_LIBRARIES )
+  endif()
+
+  find_package_handle_standard_args( Liburing
+    FOUND_VAR LIBURING_FOUND
+    REQUIRED_VARS LIBURING_INCLUDE_DIRS LIBURING_LIBRARIES )
+endif()
+
+if( NOT TARGET Liburing::Liburing AND LIBURING_FOUND )
+  add_library( Liburing::Liburing INTERFACE IMPORTED )
+  target_include_directories( Liburing::Liburing INTERFACE ${LIBURING_INCLUDE_DIRS} )
+  target_link_libraries( Liburing::Liburing INTERFACE ${LIBURING_LIBRARIES} )
+endif()
@@ -1219,7 +1219,10 @@ void Character::turn(const position &posi) {
 }
 
 auto Character::move(direction dir, bool active) -> bool {
-    World::triggerFieldMove(this, false);
+    try {
+        World::triggerFieldMove(this, _world->fieldAt(pos), false);
+    } catch (FieldNotFound &) {
+    }
 
     // if we move we look into that direction...
     if (dir != dir_up && dir != dir_down) {
@@ -1253,7 +1256,7 @@ auto Character::move(direction dir, bool active) -> bool {
             // check if there are teleporters or other special flags on this field
             World::checkFieldAfterMove(this, newField);
 
-            World::triggerFieldMove(this, true);
+            World::triggerFieldMove(this, newField, true);
 
             return true;
         }
@@ -95,7 +95,12 @@ public:
 
     const ConfigEntry<int16_t> debug{"debug", 0};
 
+    // hard limit for the Lua heap in MiB, 0 disables the limit
+    const ConfigEntry<uint32_t> lua_memory_limit{"lua_memory_limit", 0};
+
     const ConfigEntry<uint16_t> clientversion{"clientversion", 122};
+    const ConfigEntry<uint16_t> compression_clientversion{"compression_clientversion", 0};
+    const ConfigEntry<uint32_t> send_queue_limit{"send_queue_limit", 4096};
     const ConfigEntry<int16_t> playerstart_x{"playerstart_x", 0};
     const ConfigEntry<int16_t> playerstart_y{"playerstart_y", 0};
     const ConfigEntry<int16_t> playerstart_z{"playerstart_z", 0};
@@ -47,7 +47,12 @@ void InitialConnection::run_service() {
                                [shared_this = shared_from_this(), newConnection](auto &&PH1) {
                                    shared_this->accept_connection(newConnection, PH1);
                                });
-        Logger::info(LogFacility::Other) << "Starting the io service." << Log::end;
+#ifdef BOOST_ASIO_HAS_IO_URING
+        constexpr auto backend = "io_uring";
+#else
+        constexpr auto backend = "epoll";
+#endif
+        Logger::info(LogFacility::Other) << "Starting the io service using " << backend << "." << Log::end;
         io_service.run();
     } catch (const boost::system::system_error &e) {
         Logger::critical(LogFacility::Other) << "Failed to start io service: " << e.what() << Log::end;
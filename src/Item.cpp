@@ -68,13 +68,13 @@ auto Item::operator==(const Item &rhs) const -> bool {
     equal &= (number == rhs.number);
     equal &= (wear == rhs.wear);
     equal &= (quality == rhs.quality);
-    equal &= (datamap == rhs.datamap);
+    equal &= equalData(rhs);
 
     return equal;
 }
 
 Item::Item(id_type id, number_type number, wear_type wear, quality_type quality, const script_data_exchangemap &datamap)
-        : id(id), number(number), wear(wear), quality(quality), datamap(1) {
+        : id(id), number(number), wear(wear), quality(quality) {
     setData(&datamap);
 }
 
@@ -105,7 +105,7 @@ void Item::setMinQuality(const Item &item) {
 
 void Item::setData(script_data_exchangemap const *datamap) {
     if (datamap == nullptr) {
-        this->datamap.clear();
+        this->datamap.reset();
         return;
     }
 
@@ -124,21 +124,43 @@ auto Item::hasData(const script_data_exchangemap &datamap) const -> bool {
     return all_of(datamap, dataEqual);
 }
 
-auto Item::hasNoData() const -> bool { return datamap.empty(); }
+auto Item::hasNoData() const -> bool { return !datamap || datamap->empty(); }
 
 auto Item::getData(const std::string &key) const -> std::string {
-    if (datamap.find(key) != datamap.end()) {
-        return datamap.at(key);
+    if (datamap) {
+        if (const auto it = datamap->find(key); it != datamap->end()) {
+            return it->second;
+        }
     }
+
     return "";
 }
 
 void Item::setData(const std::string &key, const std::string &value) {
     if (value.length() > 0) {
-        datamap[key] = value;
-    } else {
-        datamap.erase(key);
+        mutableData()[key] = value;
+    } else if (datamap && datamap->contains(key)) {
+        mutableData().erase(key);
+
+        if (datamap->empty()) {
+            datamap.reset();
+        }
+    }
+}
+
+auto Item::data() const -> const datamap_type & {
+    static const datamap_type noData;
+    return datamap ? *datamap : noData;
+}
+
+auto Item::mutableData() -> datamap_type & {
+    if (!datamap) {
+        datamap = std::make_shared<datamap_type>();
+    } else if (datamap.use_count() > 1) {
+        datamap = std::make_shared<datamap_type>(*datamap);
     }
+
+    return *datamap;
 }
 
 void Item::setData(const std::string &key, int32_t value) {
@@ -158,7 +180,7 @@ void Item::reset() {
     number = 0;
     wear = 0;
     quality = defaultQuality;
-    datamap.clear();
+    datamap.reset();
 }
 
 void Item::resetWear() {
@@ -176,10 +198,10 @@ void Item::save(std::ofstream &obj) const {
     writeToStream(obj, number);
     writeToStream(obj, wear);
     writeToStream(obj, quality);
-    const auto mapsize = static_cast<uint8_t>(datamap.size());
+    const auto mapsize = static_cast<uint8_t>(data().size());
     writeToStream(obj, mapsize);
 
-    for (const auto &data : datamap) {
+    for (const auto &data : data()) {
         const auto sz1 = static_cast<uint8_t>(data.first.size());
         const auto sz2 = static_cast<uint8_t>(data.second.size());
         writeToStream(obj, sz1);
@@ -206,7 +228,7 @@ void Item::load(std::ifstream &obj) {
         readFromStream(obj, key.data(), sz1);
         std::string value(sz2, '\0');
         readFromStream(obj, value.data(), sz2);
-        datamap[key] = value;
+        mutableData()[key] = value;
     }
 }
 
@@ -25,6 +25,7 @@
 #include "globals.hpp"
 #include "types.hpp"
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -49,7 +50,7 @@ public:
 
     Item() = default;
     Item(id_type id, number_type number, wear_type wear, quality_type quality = defaultQuality)
-            : id(id), number(number), wear(wear), quality(quality), datamap(1) {}
+            : id(id), number(number), wear(wear), quality(quality) {}
     Item(id_type id, number_type number, wear_type wear, quality_type quality, const script_data_exchangemap &datamap);
 
     inline auto getId() const -> id_type { return id; }
@@ -74,14 +75,16 @@ public:
     auto getData(const std::string &key) const -> std::string;
     void setData(const std::string &key, const std::string &value);
     void setData(const std::string &key, int32_t value);
-    inline auto getDataBegin() const -> datamap_type::const_iterator { return datamap.cbegin(); }
-    inline auto getDataEnd() const -> datamap_type::const_iterator { return datamap.cend(); }
+    inline auto getDataBegin() const -> datamap_type::const_iterator { return data().cbegin(); }
+    inline auto getDataEnd() const -> datamap_type::const_iterator { return data().cend(); }
     inline auto equalData(script_data_exchangemap const *data) const -> bool {
         Item item;
         item.setData(data);
         return equalData(item);
     }
-    inline auto equalData(const Item &item) const -> bool { return datamap == item.datamap; }
+    inline auto equalData(const Item &item) const -> bool {
+        return datamap == item.datamap || data() == item.data();
+    }
 
     auto getDepot() const -> uint16_t;
 
@@ -110,7 +113,12 @@ private:
     number_type number{0};
     wear_type wear{0};
     quality_type quality{defaultQuality};
-    datamap_type datamap{1};
+    // shared between copies and only cloned when a copy is modified, so handing
+    // items to scripts does not copy their data, nullptr if there is no data
+    std::shared_ptr<datamap_type> datamap;
+
+    [[nodiscard]] auto data() const -> const datamap_type &;
+    auto mutableData() -> datamap_type &;
 };
 
 class ScriptItem : public Item {
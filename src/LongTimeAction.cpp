@@ -35,6 +35,8 @@
 #include <memory>
 #include <utility>
 
+uint64_t LongTimeAction::lastActionId = 0;
+
 LongTimeAction::LongTimeAction(Player *player, World *world) : _owner(player), _world(world) {}
 
 void LongTimeAction::setLastAction(std::shared_ptr<LuaScript> script, const ActionParameters &parameters,
@@ -49,26 +51,6 @@ void LongTimeAction::setLastAction(std::shared_ptr<LuaScript> script, const Acti
     }
 }
 
-auto LongTimeAction::checkAction() -> bool {
-    if (_actionrunning) {
-        // check if timetowaittimer is initialized and if we hit the next time
-        if (_timetowaitTimer && _timetowaitTimer->intervalExceeded()) {
-            successAction();
-            return true;
-        }
-
-        if ((_redoaniTimer) && (_redoaniTimer->intervalExceeded()) && (_ani != 0)) {
-            _world->gfx(_ani, _owner->getPosition());
-        }
-
-        if ((_redosoundTimer) && (_redosoundTimer->intervalExceeded()) && (_sound != 0)) {
-            _world->makeSound(_sound, _owner->getPosition());
-        }
-    }
-
-    return false;
-}
-
 void LongTimeAction::startLongTimeAction(unsigned short int timetowait, unsigned short int ani,
                                          unsigned short int redoani, unsigned short int sound,
                                          unsigned short int redosound) {
@@ -76,27 +58,23 @@ void LongTimeAction::startLongTimeAction(unsigned short int timetowait, unsigned
     currentActionParameters = currentScriptParameters;
 
     _actionrunning = true;
+    actionId = ++lastActionId;
     _ani = ani;
     _sound = sound;
     constexpr auto dsToMsFactor = 100;
     using std::chrono::milliseconds;
 
-    _timetowaitTimer = std::make_unique<Timer>(milliseconds(timetowait * dsToMsFactor));
+    _redoani = milliseconds(redoani * dsToMsFactor);
+    _redosound = milliseconds(redosound * dsToMsFactor);
 
-    if (_redoaniTimer) {
-        _redoaniTimer.reset();
-    }
+    scheduleDeadline(milliseconds(timetowait * dsToMsFactor), &LongTimeAction::successAction, "lta_success");
 
     if (_ani != 0 && redoani != 0) {
-        _redoaniTimer = std::make_unique<Timer>(milliseconds(redoani * dsToMsFactor));
-    }
-
-    if (_redosoundTimer) {
-        _redosoundTimer.reset();
+        scheduleDeadline(_redoani, &LongTimeAction::repeatAnimation, "lta_animation");
     }
 
     if (_sound != 0 && redosound != 0) {
-        _redosoundTimer = std::make_unique<Timer>(milliseconds(redosound * dsToMsFactor));
+        scheduleDeadline(_redosound, &LongTimeAction::repeatSound, "lta_sound");
     }
 
     if (_sound != 0) {
@@ -108,6 +86,40 @@ void LongTimeAction::startLongTimeAction(unsigned short int timetowait, unsigned
     }
 }
 
+void LongTimeAction::scheduleDeadline(std::chrono::milliseconds delay, void (LongTimeAction::*handler)(),
+                                      const std::string &name) {
+    // the owner may log out before the deadline, so it is looked up again
+    _world->scheduler.addOneshotTask(
+            [playerId = _owner->getId(), action = actionId, handler] {
+                auto *player = World::get()->Players.find(playerId);
+
+                if (player == nullptr || !player->Connection->online) {
+                    return;
+                }
+
+                auto &ltAction = *player->ltAction;
+
+                if (ltAction._actionrunning && ltAction.actionId == action) {
+                    (ltAction.*handler)();
+                }
+            },
+            delay, name);
+}
+
+void LongTimeAction::repeatAnimation() {
+    if (_ani != 0) {
+        _world->gfx(_ani, _owner->getPosition());
+        scheduleDeadline(_redoani, &LongTimeAction::repeatAnimation, "lta_animation");
+    }
+}
+
+void LongTimeAction::repeatSound() {
+    if (_sound != 0) {
+        _world->makeSound(_sound, _owner->getPosition());
+        scheduleDeadline(_redosound, &LongTimeAction::repeatSound, "lta_sound");
+    }
+}
+
 auto LongTimeAction::actionDisturbed(Character *disturber) -> bool {
     checkSource();
 
@@ -234,9 +246,6 @@ void LongTimeAction::abortAction() {
 
     _actionrunning = false;
     script.reset();
-    _redoaniTimer.reset();
-    _redosoundTimer.reset();
-    _timetowaitTimer.reset();
     _ani = 0;
     _sound = 0;
 }
@@ -302,9 +311,6 @@ void LongTimeAction::successAction() {
 
     if (!_actionrunning) {
         script.reset();
-        _redoaniTimer.reset();
-        _redosoundTimer.reset();
-        _timetowaitTimer.reset();
         _ani = 0;
         _sound = 0;
     }
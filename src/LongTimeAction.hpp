@@ -20,9 +20,9 @@
 #define LONG_TIME_ACTION_HPP
 
 #include "Item.hpp"
-#include "Timer.hpp"
 #include "Character.hpp"
 
+#include <chrono>
 #include <memory>
 
 class Player;
@@ -150,12 +150,6 @@ public:
      */
     void successAction();
 
-    /**
-     *checks the last Action of the player if its maybe succseful
-     *@return true if the action was successfully performed
-     */
-    auto checkAction() -> bool;
-
     /**
      *checks if currently an action is running or not
      * @return true if there is a action running
@@ -174,12 +168,11 @@ private:
 
     bool _actionrunning = false; /**< boolean value, if true there is currently a action running*/
 
-    std::unique_ptr<Timer> _timetowaitTimer =
-            nullptr; /**< timer which determines how many ms the action has to wait until it is sucessful*/
-    std::unique_ptr<Timer> _redoaniTimer =
-            nullptr; /**< timer which determines after how many ms the animation is shown again*/
-    std::unique_ptr<Timer> _redosoundTimer =
-            nullptr; /**< timer which determines how many ms the sound is played again.*/
+    static uint64_t lastActionId;
+    uint64_t actionId = 0; /**< id of the running action, deadlines of earlier actions are ignored*/
+
+    std::chrono::milliseconds _redoani{0};   /**< after how many ms the animation is shown again*/
+    std::chrono::milliseconds _redosound{0}; /**< after how many ms the sound is played again*/
 
     ActionType currentScriptType = ActionType::USE;
     ActionType currentActionType = ActionType::USE;
@@ -188,6 +181,14 @@ private:
     unsigned short int _ani = 0;   /**< id of the animation which is shown to the action*/
 
     void checkSource();
+
+    /**
+     *registers a callback with the world scheduler which is only invoked if
+     *the current action is still running when the delay has passed
+     */
+    void scheduleDeadline(std::chrono::milliseconds delay, void (LongTimeAction::*handler)(), const std::string &name);
+    void repeatAnimation();
+    void repeatSound();
 };
 
 #endif
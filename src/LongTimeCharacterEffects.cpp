@@ -20,8 +20,10 @@
 
 #include "LongTimeCharacterEffects.hpp"
 
+#include "Config.hpp"
 #include "LongTimeEffect.hpp"
 #include "Player.hpp"
+#include "World.hpp"
 #include "data/Data.hpp"
 #include "db/Connection.hpp"
 #include "db/ConnectionManager.hpp"
@@ -32,8 +34,31 @@
 #include <algorithm>
 #include <range/v3/all.hpp>
 #include <string>
+#include <unordered_map>
 
-LongTimeCharacterEffects::LongTimeCharacterEffects(Character *owner) : owner(owner), time(0) {}
+LongTimeCharacterEffects::LongTimeCharacterEffects(Character *owner) : owner(owner) {}
+
+auto LongTimeCharacterEffects::currentTime() -> int32_t { return World::get()->effectQueue.now(); }
+
+void LongTimeCharacterEffects::scheduleWakeup() {
+    if (effects.empty() || owner == nullptr) {
+        return;
+    }
+
+    const auto now = currentTime();
+
+    if (wakeup && *wakeup <= now) {
+        wakeup.reset();
+    }
+
+    // never wake up in the current tick again, otherwise an effect with no delay would be called endlessly
+    const auto deadline = std::max(effects.front()->getExecutionTime(), now + 1);
+
+    if (!wakeup || deadline < *wakeup) {
+        wakeup = deadline;
+        World::get()->effectQueue.schedule(deadline, owner->getId());
+    }
+}
 
 auto LongTimeCharacterEffects::find(uint16_t effectid, LongTimeEffect *&effect) const -> bool {
     using namespace ranges;
@@ -74,7 +99,7 @@ void LongTimeCharacterEffects::addEffect(std::unique_ptr<LongTimeEffect> effect)
     }
 
     if (!find(effect->getEffectId(), foundeffect)) {
-        effect->setExecutionTime(time);
+        effect->setExecutionTime(currentTime());
 
         if (effect->isFirstAdd()) {
             const auto &script = Data::longTimeEffects().script(effect->getEffectId());
@@ -87,6 +112,7 @@ void LongTimeCharacterEffects::addEffect(std::unique_ptr<LongTimeEffect> effect)
         effect->firstAdd();
         effects.push_back(std::move(effect));
         std::push_heap(effects.begin(), effects.end(), LongTimeEffect::priority);
+        scheduleWakeup();
     } else {
         const auto &script = Data::longTimeEffects().script(effect->getEffectId());
 
@@ -151,7 +177,7 @@ auto LongTimeCharacterEffects::removeEffect(const LongTimeEffect *effect) -> boo
 }
 
 void LongTimeCharacterEffects::checkEffects() {
-    ++time;
+    const auto time = currentTime();
     constexpr auto scriptLimit = 200;
     int emexit = 0;
 
@@ -171,52 +197,59 @@ void LongTimeCharacterEffects::checkEffects() {
             }
         }
     }
+
+    scheduleWakeup();
 }
 
-auto LongTimeCharacterEffects::save() -> bool {
+void LongTimeCharacterEffects::save(const Database::PConnection &connection) const {
     using namespace Database;
 
-    if ((owner != nullptr) && owner->getType() != Character::player) {
-        return false;
+    if (owner == nullptr || owner->getType() != Character::player) {
+        return;
     }
 
-    auto *player = dynamic_cast<Player *>(owner);
+    const auto playerId = owner->getId();
+    static const auto server = Config::instance().postgres_schema_server();
 
-    if (owner == nullptr) {
-        return false;
+    {
+        DeleteQuery query(connection);
+        query.addEqualCondition<TYPE_OF_CHARACTER_ID>("playerlteffects", "plte_playerid", playerId);
+        query.setServerTable("playerlteffects");
+        query.execute();
     }
 
-    PConnection connection = ConnectionManager::getInstance().getConnection();
-    connection->beginTransaction();
+    {
+        DeleteQuery query(connection);
+        query.addEqualCondition<TYPE_OF_CHARACTER_ID>("playerlteffectvalues", "pev_playerid", playerId);
+        query.setServerTable("playerlteffectvalues");
+        query.execute();
+    }
 
-    try {
-        {
-            DeleteQuery query(connection);
-            query.addEqualCondition<TYPE_OF_CHARACTER_ID>("playerlteffects", "plte_playerid", player->getId());
-            query.setServerTable("playerlteffects");
-            query.execute();
-        }
-        {
-            DeleteQuery query(connection);
-            query.addEqualCondition<TYPE_OF_CHARACTER_ID>("playerlteffectvalues", "pev_playerid", player->getId());
-            query.setServerTable("playerlteffectvalues");
-            query.execute();
-        }
-        connection->commitTransaction();
-    } catch (std::exception &e) {
-        Logger::error(LogFacility::Database)
-                << "Error while saving long time effects for " << player->to_string() << ": " << e.what() << Log::end;
-        connection->rollbackTransaction();
-        return false;
+    if (effects.empty()) {
+        return;
     }
 
-    bool allok = true;
+    {
+        auto stream = connection->streamTo({server, "playerlteffects"},
+                                           {"plte_playerid", "plte_effectid", "plte_nextcalled", "plte_numbercalled"});
 
-    for (auto &effect : effects) {
-        allok and_eq effect->save(player->getId(), time);
+        for (const auto &effect : effects) {
+            effect->save(stream, playerId, currentTime());
+        }
+
+        stream.complete();
     }
 
-    return allok;
+    {
+        auto stream = connection->streamTo({server, "playerlteffectvalues"},
+                                           {"pev_playerid", "pev_effectid", "pev_name", "pev_value"});
+
+        for (const auto &effect : effects) {
+            effect->saveValues(stream, playerId);
+        }
+
+        stream.complete();
+    }
 }
 
 auto LongTimeCharacterEffects::load() -> bool {
@@ -231,52 +264,55 @@ auto LongTimeCharacterEffects::load() -> bool {
     PConnection connection = ConnectionManager::getInstance().getConnection();
 
     try {
+        SelectQuery valuesQuery(connection);
+        valuesQuery.addColumn("playerlteffectvalues", "pev_effectid");
+        valuesQuery.addColumn("playerlteffectvalues", "pev_name");
+        valuesQuery.addColumn("playerlteffectvalues", "pev_value");
+        valuesQuery.addEqualCondition<TYPE_OF_CHARACTER_ID>("playerlteffectvalues", "pev_playerid", player->getId());
+        valuesQuery.addServerTable("playerlteffectvalues");
+
+        std::unordered_multimap<uint16_t, std::pair<std::string, uint32_t>> effectValues;
+
+        for (const auto &valueRow : valuesQuery.execute()) {
+            effectValues.emplace(valueRow["pev_effectid"].as<uint16_t>(),
+                                 std::make_pair(valueRow["pev_name"].as<std::string>(),
+                                                valueRow["pev_value"].as<uint32_t>()));
+        }
+
         SelectQuery query(connection);
         query.addColumn("playerlteffects", "plte_effectid");
         query.addColumn("playerlteffects", "plte_nextcalled");
         query.addColumn("playerlteffects", "plte_numbercalled");
         query.addEqualCondition<TYPE_OF_CHARACTER_ID>("playerlteffects", "plte_playerid", player->getId());
         query.addServerTable("playerlteffects");
-        query.addOrderBy("playerlteffects", "plte_nextcalled", SelectQuery::ASC);
 
         Result results = query.execute();
 
-        if (!results.empty()) {
-            for (const auto &row : results) {
-                auto effectId = row["plte_effectid"].as<uint16_t>();
-                auto effect = std::make_unique<LongTimeEffect>(effectId, row["plte_nextcalled"].as<int32_t>());
-
-                effect->setExecutionTime(time);
-                effect->firstAdd();
-                effect->setNumberOfCalls(row["plte_numberCalled"].as<uint32_t>());
+        for (const auto &row : results) {
+            auto effectId = row["plte_effectid"].as<uint16_t>();
+            auto effect = std::make_unique<LongTimeEffect>(effectId, row["plte_nextcalled"].as<int32_t>());
 
-                SelectQuery valuesQuery(connection);
-                valuesQuery.addColumn("playerlteffectvalues", "pev_name");
-                valuesQuery.addColumn("playerlteffectvalues", "pev_value");
-                valuesQuery.addEqualCondition<TYPE_OF_CHARACTER_ID>("playerlteffectvalues", "pev_playerid",
-                                                                    player->getId());
-                valuesQuery.addEqualCondition<uint16_t>("playerlteffectvalues", "pev_effectid", effectId);
-                valuesQuery.addServerTable("playerlteffectvalues");
+            effect->setExecutionTime(currentTime());
+            effect->firstAdd();
+            effect->setNumberOfCalls(row["plte_numberCalled"].as<uint32_t>());
 
-                Result valuesResults = valuesQuery.execute();
+            const auto [valuesBegin, valuesEnd] = effectValues.equal_range(effectId);
 
-                if (!valuesResults.empty()) {
-                    for (const auto &valueRow : valuesResults) {
-                        effect->addValue(valueRow["pev_name"].as<std::string>(), valueRow["pev_value"].as<uint32_t>());
-                    }
-                }
-
-                const auto &script = Data::longTimeEffects().script(effectId);
+            for (auto value = valuesBegin; value != valuesEnd; ++value) {
+                effect->addValue(value->second.first, value->second.second);
+            }
 
-                if (script) {
-                    script->loadEffect(effect.get(), player);
-                }
+            const auto &script = Data::longTimeEffects().script(effectId);
 
-                effects.push_back(std::move(effect));
+            if (script) {
+                script->loadEffect(effect.get(), player);
             }
+
+            effects.push_back(std::move(effect));
         }
 
         std::make_heap(effects.begin(), effects.end(), LongTimeEffect::priority);
+        scheduleWakeup();
 
         return true;
     } catch (std::exception &e) {
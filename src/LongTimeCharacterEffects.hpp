@@ -22,8 +22,10 @@
 #define LONGTIMECHARACTEREFFECTS_HPP_
 
 #include "LongTimeEffect.hpp"
+#include "db/Connection.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -41,8 +43,10 @@ public:
     auto removeEffect(const std::string &name) -> bool;
     auto removeEffect(const LongTimeEffect *effect) -> bool;
 
+    // called by the world when the next effect is due
     void checkEffects();
-    auto save() -> bool;
+    // writes all effects within the active transaction of connection
+    void save(const Database::PConnection &connection) const;
     auto load() -> bool;
 
 private:
@@ -51,7 +55,11 @@ private:
 
     Character *owner;
 
-    int32_t time;
+    // tick at which this character is queued to be woken up
+    std::optional<int32_t> wakeup;
+
+    [[nodiscard]] static auto currentTime() -> int32_t;
+    void scheduleWakeup();
 };
 
 #endif
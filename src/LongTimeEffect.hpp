@@ -24,6 +24,10 @@
 #include <string>
 #include <unordered_map>
 
+namespace pqxx {
+class stream_to;
+}
+
 class Character;
 class Player;
 struct LTEPriority;
@@ -37,7 +41,8 @@ public:
     auto findValue(const std::string &name, uint32_t &ret) -> bool;
 
     auto callEffect(Character *target) -> bool;
-    auto save(uint32_t playerid, int32_t currentTime) -> bool;
+    void save(pqxx::stream_to &effectStream, uint32_t playerid, int32_t currentTime) const;
+    void saveValues(pqxx::stream_to &valueStream, uint32_t playerid) const;
 
     auto isFirstAdd() const -> bool { return firstadd; }
     void firstAdd() { firstadd = false; }
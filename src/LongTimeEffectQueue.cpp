@@ -0,0 +1,35 @@
+/*
+ * Illarionserver - server for the game Illarion
+ * Copyright 2011 Illarion e.V.
+ *
+ * This file is part of Illarionserver.
+ *
+ * Illarionserver  is  free  software:  you can redistribute it and/or modify it
+ * under the terms of the  GNU Affero General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * Illarionserver is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY;  without  even  the  implied  warranty  of  MERCHANTABILITY  or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Affero General Public License along with
+ * Illarionserver. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LongTimeEffectQueue.hpp"
+
+void LongTimeEffectQueue::schedule(int32_t deadline, TYPE_OF_CHARACTER_ID character) {
+    entries.emplace(deadline, character);
+}
+
+auto LongTimeEffectQueue::popDue() -> std::optional<TYPE_OF_CHARACTER_ID> {
+    if (entries.empty() || entries.top().first > tick) {
+        return std::nullopt;
+    }
+
+    const auto character = entries.top().second;
+    entries.pop();
+    return character;
+}
@@ -0,0 +1,55 @@
+/*
+ * Illarionserver - server for the game Illarion
+ * Copyright 2011 Illarion e.V.
+ *
+ * This file is part of Illarionserver.
+ *
+ * Illarionserver  is  free  software:  you can redistribute it and/or modify it
+ * under the terms of the  GNU Affero General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * Illarionserver is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY;  without  even  the  implied  warranty  of  MERCHANTABILITY  or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Affero General Public License along with
+ * Illarionserver. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LONGTIMEEFFECTQUEUE_HPP
+#define LONGTIMEEFFECTQUEUE_HPP
+
+#include "types.hpp"
+
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+/**
+ * World wide clock of long time effects and queue of the characters whose
+ * next effect is due at a certain tick. Only characters with a due effect
+ * need to be woken up each tick.
+ */
+class LongTimeEffectQueue {
+public:
+    [[nodiscard]] auto now() const -> int32_t { return tick; }
+    void advance() { ++tick; }
+
+    void schedule(int32_t deadline, TYPE_OF_CHARACTER_ID character);
+    auto popDue() -> std::optional<TYPE_OF_CHARACTER_ID>;
+    [[nodiscard]] auto size() const -> size_t { return entries.size(); }
+
+private:
+    using Entry = std::pair<int32_t, TYPE_OF_CHARACTER_ID>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> entries;
+
+    // read by the player save thread when converting execution times
+    std::atomic<int32_t> tick = 0;
+};
+
+#endif
@@ -32,10 +32,17 @@ MonitoringClients::MonitoringClients() : _world(World::get()) {}
 void MonitoringClients::clientConnect(Player *player) {
     Logger::info(LogFacility::Admin) << "New BBIWI Client connects: " << *player
                                      << "; active clients online: " << client_list.size() << Log::end;
+    // clients already connected still get the updates collected for them
+    if (!client_list.empty()) {
+        sendUpdates();
+    }
+
     // create new Monitoring Client
     client_list.push_back(player); /*<add a new client to the list*/
     // setup the keepalive
     time(&(player->lastkeepalive));
+    // updates were not tracked without clients, the snapshot replaces them
+    monitoredPlayers.clear();
     // Send all player infos to the new connected client
 
     _world->Players.for_each([&](Player *p) {
@@ -56,6 +63,51 @@ void MonitoringClients::sendCommand(const ServerCommandPointer &command) const {
     }
 }
 
+void MonitoringClients::playerMoved(const Player &player) {
+    if (!client_list.empty()) {
+        monitoredPlayers[player.getId()].moved = true;
+    }
+}
+
+void MonitoringClients::attributeChanged(const Player &player, Character::attributeIndex attribute,
+                                         short int value) {
+    if (!client_list.empty()) {
+        monitoredPlayers[player.getId()].changedAttributes.at(attribute) = value;
+    }
+}
+
+void MonitoringClients::sendUpdates() {
+    for (auto it = monitoredPlayers.begin(); it != monitoredPlayers.end();) {
+        const auto id = it->first;
+        auto &state = it->second;
+        auto *player = _world->Players.find(id);
+
+        if (player == nullptr) {
+            it = monitoredPlayers.erase(it);
+            continue;
+        }
+
+        if (state.moved) {
+            state.moved = false;
+            sendCommand(std::make_shared<BBPlayerMoveTC>(id, player->getPosition()));
+        }
+
+        for (size_t attribute = 0; attribute < state.changedAttributes.size(); ++attribute) {
+            auto &changed = state.changedAttributes[attribute];
+
+            if (changed && changed != state.sentAttributes[attribute]) {
+                const auto index = static_cast<Character::attributeIndex>(attribute);
+                sendCommand(std::make_shared<BBSendAttribTC>(id, Character::attributeStringMap[index], *changed));
+                state.sentAttributes[attribute] = changed;
+            }
+
+            changed.reset();
+        }
+
+        ++it;
+    }
+}
+
 void MonitoringClients::CheckClients() {
     for (auto it = client_list.begin(); it != client_list.end(); ++it) {
         time_t thetime = 0;
@@ -83,4 +135,10 @@ void MonitoringClients::CheckClients() {
 
         time(&thetime);
     }
+
+    if (client_list.empty()) {
+        monitoredPlayers.clear();
+    } else {
+        sendUpdates();
+    }
 }
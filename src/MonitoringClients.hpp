@@ -19,9 +19,13 @@
 #ifndef CMONITORINGCLIENTS
 #define CMONITORINGCLIENTS
 
+#include "Character.hpp"
 #include "netinterface/BasicServerCommand.hpp"
 
+#include <array>
 #include <list>
+#include <optional>
+#include <unordered_map>
 
 class World;
 class Player;
@@ -46,13 +50,37 @@ public:
      */
     void sendCommand(const ServerCommandPointer &command) const;
 
+    /**
+     * remembers that a player moved, the clients receive the position once per check interval
+     * @param player the player who moved
+     */
+    void playerMoved(const Player &player);
+
+    /**
+     * remembers the new value of an attribute, the clients receive it with the next check
+     * if it differs from the value they were sent last
+     * @param player the player whose attribute changed
+     * @param attribute the changed attribute
+     * @param value the new value
+     */
+    void attributeChanged(const Player &player, Character::attributeIndex attribute, short int value);
+
     /**
      * function which checks if new commands from clients are arrived and handels them
      */
     void CheckClients();
 
 private:
+    struct MonitoredPlayer {
+        bool moved = false;
+        std::array<std::optional<short int>, Character::ATTRIBUTECOUNT> changedAttributes;
+        std::array<std::optional<short int>, Character::ATTRIBUTECOUNT> sentAttributes;
+    };
+
+    void sendUpdates();
+
     std::list<Player *> client_list;
+    std::unordered_map<TYPE_OF_CHARACTER_ID, MonitoredPlayer> monitoredPlayers;
     World *_world; /*< pointer to the gameworld*/
 };
 #endif
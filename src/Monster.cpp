@@ -22,6 +22,7 @@
 #include "Random.hpp"
 #include "WaypointList.hpp"
 #include "World.hpp"
+#include "data/Data.hpp"
 #include "data/MonsterTable.hpp"
 #include "data/RaceTypeTable.hpp"
 #include "script/LuaMonsterScript.hpp"
@@ -34,6 +35,7 @@ extern std::unique_ptr<MonsterTable> monsterDescriptions;
 extern std::unique_ptr<RaceTypeTable> raceTypes;
 
 uint32_t Monster::counter = 0;
+uint32_t Monster::combatProfileGeneration = 1;
 
 Monster::Monster(const TYPE_OF_CHARACTER_ID &type, const position &newpos, SpawnPoint *spawnpoint)
         : lastTargetPosition(position(0, 0, 0)), spawn(spawnpoint), monstertype(type) {
@@ -70,6 +72,7 @@ void Monster::performStep(position targetpos) {
 
 void Monster::setMonsterType(TYPE_OF_CHARACTER_ID type) {
     deleteAllSkills();
+    profileGeneration = 0;
 
     if (!monsterDescriptions->exists(type)) {
         throw unknownIDException();
@@ -140,6 +143,39 @@ void Monster::setMonsterType(TYPE_OF_CHARACTER_ID type) {
     setSkinColour(raceConfiguration.skinColour);
 }
 
+auto Monster::getCombatProfile() -> const CombatProfile & {
+    const auto leftTool = items.at(LEFT_TOOL).getId();
+    const auto rightTool = items.at(RIGHT_TOOL).getId();
+
+    if (profileGeneration == combatProfileGeneration && profileLeftTool == leftTool &&
+        profileRightTool == rightTool) {
+        return combatProfile;
+    }
+
+    combatProfile = CombatProfile{};
+
+    if (Data::weaponItems().exists(rightTool)) {
+        combatProfile.range = Data::weaponItems()[rightTool].Range;
+    } else if (Data::weaponItems().exists(leftTool)) {
+        combatProfile.range = Data::weaponItems()[leftTool].Range;
+    }
+
+    combatProfile.hasDefinition = monsterDescriptions->exists(getMonsterType());
+
+    if (combatProfile.hasDefinition) {
+        const auto &monStruct = (*monsterDescriptions)[getMonsterType()];
+        combatProfile.script = monStruct.script;
+        combatProfile.canSelfHeal = monStruct.canselfheal;
+    }
+
+    profileGeneration = combatProfileGeneration;
+    profileLeftTool = leftTool;
+    profileRightTool = rightTool;
+    return combatProfile;
+}
+
+void Monster::invalidateCombatProfiles() { ++combatProfileGeneration; }
+
 void Monster::setSpawn(SpawnPoint *sp) { spawn = sp; }
 
 Monster::~Monster() {
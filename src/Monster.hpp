@@ -20,6 +20,7 @@
 #define MONSTER_HPP
 
 #include "Character.hpp"
+#include "MonsterPool.hpp"
 #include "data/MonsterTable.hpp"
 
 class SpawnPoint;
@@ -35,6 +36,17 @@ public:
      */
     class unknownIDException {};
 
+    /**
+     * combat data derived from the monster definition and the equipped tools,
+     * cached so the monster loop does not repeat the table lookups every turn
+     */
+    struct CombatProfile {
+        uint16_t range = 1;                       /**< attack range of the equipped weapon */
+        std::shared_ptr<LuaMonsterScript> script; /**< script of the monster type, if any */
+        bool canSelfHeal = false;                 /**< if true the monster heals instead of random steps */
+        bool hasDefinition = false;               /**< false if the monster type is missing from the table */
+    };
+
     /**
      * the constructor which creates the monster on the map
      * @param type the monster type of this monster
@@ -101,6 +113,19 @@ public:
 
     void heal();
 
+    /**
+     * returns the cached combat profile, recomputing it if the equipped tools
+     * changed or the definitions were reloaded since it was last computed
+     * @return the combat profile of this monster
+     */
+    auto getCombatProfile() -> const CombatProfile &;
+
+    /**
+     * marks the combat profiles of all monsters as outdated, must be called
+     * after the monster or weapon definitions were reloaded
+     */
+    static void invalidateCombatProfiles();
+
     /**
      *trys to find a path to the the targetposition and performs a step
      *in the direction
@@ -108,6 +133,10 @@ public:
      */
     void performStep(position targetpos);
 
+    // monsters are spawned and killed constantly, their memory is recycled
+    static auto operator new(size_t size) -> void * { return MonsterPool::allocate(size); }
+    static void operator delete(void *block, size_t size) noexcept { MonsterPool::deallocate(block, size); }
+
     ~Monster() override;
     Monster(const Monster &) = delete;
     auto operator=(const Monster &) -> Monster & = delete;
@@ -134,6 +163,12 @@ private:
     SpawnPoint *spawn = nullptr;
     TYPE_OF_CHARACTER_ID monstertype = 0;
     bool _canAttack = true;
+
+    static uint32_t combatProfileGeneration;
+    CombatProfile combatProfile;
+    uint32_t profileGeneration = 0;
+    TYPE_OF_ITEM_ID profileLeftTool = 0;
+    TYPE_OF_ITEM_ID profileRightTool = 0;
 };
 
 #endif
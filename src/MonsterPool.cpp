@@ -0,0 +1,90 @@
+//  illarionserver - server for the game Illarion
+//  Copyright 2011 Illarion e.V.
+//
+//  This file is part of illarionserver.
+//
+//  illarionserver is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  illarionserver is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with illarionserver.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "MonsterPool.hpp"
+
+#include "Monster.hpp"
+
+#include <algorithm>
+#include <new>
+
+uint64_t MonsterPool::monsters = 0;
+uint64_t MonsterPool::blockAllocations = 0;
+size_t MonsterPool::blocksInUse = 0;
+size_t MonsterPool::peakBlocksInUse = 0;
+size_t MonsterPool::reserved = 0;
+
+auto MonsterPool::freeBlocks() -> std::vector<void *> & {
+    static auto *blocks = new std::vector<void *>();
+    return *blocks;
+}
+
+auto MonsterPool::allocate(size_t size) -> void * {
+    // derived classes have a different size and are not pooled
+    if (size != sizeof(Monster)) {
+        return ::operator new(size);
+    }
+
+    ++monsters;
+    peakBlocksInUse = std::max(peakBlocksInUse, ++blocksInUse);
+    auto &blocks = freeBlocks();
+
+    if (!blocks.empty()) {
+        void *block = blocks.back();
+        blocks.pop_back();
+        return block;
+    }
+
+    ++blockAllocations;
+    return ::operator new(size);
+}
+
+void MonsterPool::deallocate(void *block, size_t size) noexcept {
+    if (size != sizeof(Monster)) {
+        ::operator delete(block);
+        return;
+    }
+
+    --blocksInUse;
+
+    try {
+        auto &blocks = freeBlocks();
+
+        if (blocks.size() < std::max(reserved, minFreeBlocks)) {
+            blocks.push_back(block);
+            return;
+        }
+    } catch (...) {
+    }
+
+    ::operator delete(block);
+}
+
+void MonsterPool::reserve(size_t count) {
+    reserved = count;
+    auto &blocks = freeBlocks();
+
+    while (blocksInUse + blocks.size() < count) {
+        ++blockAllocations;
+        blocks.push_back(::operator new(sizeof(Monster)));
+    }
+}
+
+auto MonsterPool::getStats() -> Stats {
+    return {monsters, blockAllocations, blocksInUse, peakBlocksInUse, freeBlocks().size()};
+}
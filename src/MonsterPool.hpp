@@ -0,0 +1,65 @@
+//  illarionserver - server for the game Illarion
+//  Copyright 2011 Illarion e.V.
+//
+//  This file is part of illarionserver.
+//
+//  illarionserver is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  illarionserver is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with illarionserver.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef MONSTER_POOL_HPP
+#define MONSTER_POOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ *recycles the memory of killed monsters for the next spawn, each monster is
+ *still constructed from scratch so no state carries over to its successor,
+ *only used from the game loop
+ */
+class MonsterPool {
+public:
+    struct Stats {
+        uint64_t monsters;
+        uint64_t blockAllocations;
+        size_t blocksInUse;
+        size_t peakBlocksInUse;
+        size_t freeBlocks;
+    };
+
+    static auto allocate(size_t size) -> void *;
+    static void deallocate(void *block, size_t size) noexcept;
+
+    /**
+     *keeps enough blocks for the given number of monsters, allocating the
+     *missing ones immediately
+     */
+    static void reserve(size_t count);
+
+    static auto getStats() -> Stats;
+
+private:
+    static constexpr size_t minFreeBlocks = 256;
+
+    // never destroyed, monsters may still be deleted during static destruction
+    static auto freeBlocks() -> std::vector<void *> &;
+
+    static uint64_t monsters;
+    static uint64_t blockAllocations;
+    static size_t blocksInUse;
+    static size_t peakBlocksInUse;
+    static size_t reserved;
+};
+
+#endif
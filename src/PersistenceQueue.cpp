@@ -0,0 +1,125 @@
+//  illarionserver - server for the game Illarion
+//  Copyright 2011 Illarion e.V.
+//
+//  This file is part of illarionserver.
+//
+//  illarionserver is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  illarionserver is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with illarionserver.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "PersistenceQueue.hpp"
+
+#include "Logger.hpp"
+#include "db/ConnectionManager.hpp"
+
+std::unique_ptr<PersistenceQueue> PersistenceQueue::instance = nullptr;
+
+auto PersistenceQueue::get() -> PersistenceQueue & {
+    if (!instance) {
+        instance = std::make_unique<PersistenceQueue>();
+    }
+
+    return *instance;
+}
+
+void PersistenceQueue::activate() {
+    running = true;
+    write_thread = std::make_unique<std::thread>(writeLoop, this);
+}
+
+void PersistenceQueue::stop() {
+    if (!write_thread) {
+        return;
+    }
+
+    Logger::info(LogFacility::Database) << "Waiting for " << size() << " queued database writes ..." << Log::end;
+
+    {
+        std::lock_guard<std::mutex> lock(mut);
+        running = false;
+    }
+
+    jobAvailable.notify_all();
+    write_thread->join();
+    write_thread.reset();
+
+    Logger::info(LogFacility::Database) << "Persistence queue terminated!" << Log::end;
+}
+
+void PersistenceQueue::push(const std::string &name, Job job) {
+    {
+        std::lock_guard<std::mutex> lock(mut);
+
+        if (running) {
+            jobs.emplace_back(name, std::move(job));
+            ++queuedJobs;
+            jobAvailable.notify_one();
+            return;
+        }
+    }
+
+    // before activation and after shutdown there is no thread to pick the job up
+    Database::PConnection ownConnection = nullptr;
+    execute(name, job, ownConnection);
+}
+
+void PersistenceQueue::waitForQueuedJobs() {
+    std::unique_lock<std::mutex> lock(mut);
+    const auto target = queuedJobs;
+    idle.wait(lock, [this, target] { return finishedJobs >= target; });
+}
+
+auto PersistenceQueue::size() const -> size_t {
+    std::lock_guard<std::mutex> lock(mut);
+    return jobs.size();
+}
+
+void PersistenceQueue::writeLoop(PersistenceQueue *queue) {
+    while (true) {
+        std::pair<std::string, Job> next;
+
+        {
+            std::unique_lock<std::mutex> lock(queue->mut);
+            queue->jobAvailable.wait(lock, [queue] { return !queue->running || !queue->jobs.empty(); });
+
+            if (queue->jobs.empty()) {
+                return;
+            }
+
+            next = std::move(queue->jobs.front());
+            queue->jobs.pop_front();
+        }
+
+        queue->execute(next.first, next.second, queue->connection);
+
+        {
+            std::lock_guard<std::mutex> lock(queue->mut);
+            ++queue->finishedJobs;
+        }
+
+        queue->idle.notify_all();
+    }
+}
+
+void PersistenceQueue::execute(const std::string &name, const Job &job, Database::PConnection &connection) {
+    try {
+        if (!connection) {
+            connection = Database::ConnectionManager::getInstance().getConnection();
+        }
+
+        job(connection);
+    } catch (std::exception &e) {
+        Logger::error(LogFacility::Database) << "Persisting " << name << " failed: " << e.what() << Log::end;
+        // the connection might be broken, the next job starts over with a new one
+        connection.reset();
+    }
+}
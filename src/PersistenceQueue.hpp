@@ -0,0 +1,79 @@
+//  illarionserver - server for the game Illarion
+//  Copyright 2011 Illarion e.V.
+//
+//  This file is part of illarionserver.
+//
+//  illarionserver is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  illarionserver is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with illarionserver.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef PERSISTENCEQUEUE_HPP
+#define PERSISTENCEQUEUE_HPP
+
+#include "db/Connection.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * Executes database writes on a dedicated thread so that the game loop does
+ * not block on them. Jobs run one after another in the order they were
+ * queued, which keeps later writes of the same data from being overtaken by
+ * earlier ones.
+ */
+class PersistenceQueue {
+public:
+    using Job = std::function<void(const Database::PConnection &)>;
+
+    static auto get() -> PersistenceQueue &;
+
+    void activate();
+
+    /**
+     * stops accepting jobs and returns once all queued jobs have been written
+     */
+    void stop();
+
+    void push(const std::string &name, Job job);
+
+    /**
+     * returns once all jobs queued before the call have been written
+     */
+    void waitForQueuedJobs();
+
+    [[nodiscard]] auto size() const -> size_t;
+
+private:
+    static std::unique_ptr<PersistenceQueue> instance;
+
+    static void writeLoop(PersistenceQueue *queue);
+    static void execute(const std::string &name, const Job &job, Database::PConnection &connection);
+
+    mutable std::mutex mut;
+    std::condition_variable jobAvailable;
+    std::condition_variable idle;
+    std::deque<std::pair<std::string, Job>> jobs;
+    uint64_t queuedJobs = 0;
+    uint64_t finishedJobs = 0;
+    std::atomic_bool running = false;
+    Database::PConnection connection = nullptr;
+    std::unique_ptr<std::thread> write_thread = nullptr;
+};
+
+#endif
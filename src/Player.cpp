@@ -22,6 +22,7 @@
 #include "Logger.hpp"
 #include "LongTimeAction.hpp"
 #include "MonitoringClients.hpp"
+#include "PersistenceQueue.hpp"
 #include "PlayerManager.hpp"
 #include "Random.hpp"
 #include "Showcase.hpp"
@@ -53,6 +54,7 @@
 #include <memory>
 #include <range/v3/all.hpp>
 #include <sstream>
+#include <tuple>
 #include <utility>
 
 Player::Player(std::shared_ptr<NetInterface> newConnection)
@@ -725,8 +727,7 @@ void Player::sendAttrib(Character::attributeIndex attribute) {
         Connection->addCommand(cmd);
     }
 
-    ServerCommandPointer cmd = std::make_shared<BBSendAttribTC>(getId(), attributeStringMap[attribute], value);
-    _world->monitoringClientList->sendCommand(cmd);
+    _world->monitoringClientList->attributeChanged(*this, attribute, value);
 }
 
 void Player::handleAttributeChange(Character::attributeIndex attribute) {
@@ -1033,10 +1034,14 @@ auto Player::save() noexcept -> bool {
 
     Logger::debug(LogFacility::Player) << "Saving " << to_string() << Log::end;
 
+    // an older flush of this player must not land after the progress written below
+    PersistenceQueue::get().waitForQueuedJobs();
+
     PConnection connection = ConnectionManager::getInstance().getConnection();
 
     try {
         connection->beginTransaction();
+        writeQuestChanges(connection, getId(), takeQuestChanges());
         static const auto server = Config::instance().postgres_schema_server();
 
         {
@@ -1248,16 +1253,15 @@ auto Player::save() noexcept -> bool {
             dataStream.complete();
         }
 
-        connection->commitTransaction();
+        effects.save(connection);
 
-        if (!effects.save()) {
-            Logger::error(LogFacility::Player) << "error while saving lteffects for " << to_string() << Log::end;
-        }
+        connection->commitTransaction();
 
         return true;
     } catch (std::exception &e) {
         Logger::error(LogFacility::Player) << "Exception in Player::save: " << e.what() << Log::end;
         connection->rollbackTransaction();
+        *questFlushFailed = true;
         return false;
     }
 }
@@ -1752,7 +1756,11 @@ auto Player::move(direction dir, uint8_t mode) -> bool {
         reachingTargetField = now;
     }
 
-    World::triggerFieldMove(this, false);
+    try {
+        World::triggerFieldMove(this, _world->fieldAt(getPosition()), false);
+    } catch (FieldNotFound &) {
+    }
+
     closeOnMove();
 
     // if we actively move we look into that direction...
@@ -1832,7 +1840,7 @@ auto Player::move(direction dir, uint8_t mode) -> bool {
 
                 if (mode != RUNNING || j == 1 || !cont) {
                     _world->sendCharacterMoveToAllVisiblePlayers(this, mode, walkcost);
-                    _world->sendAllVisibleCharactersToPlayer(this, true);
+                    _world->sendEnteringCharactersToPlayer(this, true);
                 }
 
                 if (newField.isWarp()) {
@@ -1842,11 +1850,12 @@ auto Player::move(direction dir, uint8_t mode) -> bool {
                     cont = false;
                 }
 
-                World::checkFieldAfterMove(this, newField);
+                // a warp leaves the character on another field
+                const auto &reachedField = getPosition() == newpos ? newField : _world->fieldAt(getPosition());
+                World::checkFieldAfterMove(this, reachedField);
 
-                World::triggerFieldMove(this, true);
-                ServerCommandPointer cmd = std::make_shared<BBPlayerMoveTC>(getId(), getPosition());
-                _world->monitoringClientList->sendCommand(cmd);
+                World::triggerFieldMove(this, reachedField, true);
+                _world->monitoringClientList->playerMoved(*this);
 
                 if (mode != RUNNING || j == 1) {
                     return true;
@@ -1861,7 +1870,7 @@ auto Player::move(direction dir, uint8_t mode) -> bool {
                 Connection->addCommand(cmd);
                 sendStepStripes(dir);
                 _world->sendCharacterMoveToAllVisiblePlayers(this, mode, walkcost);
-                _world->sendAllVisibleCharactersToPlayer(this, true);
+                _world->sendEnteringCharactersToPlayer(this, true);
                 return true;
             }
             if (j == 0) {
@@ -1910,8 +1919,7 @@ void Player::handleWarp() {
     sendFullMap();
     visibleChars.clear();
     _world->sendAllVisibleCharactersToPlayer(this, true);
-    cmd = std::make_shared<BBPlayerMoveTC>(getId(), getPosition());
-    _world->monitoringClientList->sendCommand(cmd);
+    _world->monitoringClientList->playerMoved(*this);
 }
 
 void Player::openDepot(const ScriptItem &item) {
@@ -1943,53 +1951,95 @@ void Player::setQuestProgress(TYPE_OF_QUEST_ID questid, TYPE_OF_QUESTSTATUS prog
     }
 
     questWriteLock = true;
-    using namespace Database;
-    PConnection connection = ConnectionManager::getInstance().getConnection();
     int timeNow = int(time(nullptr));
+    quests[questid] = std::make_pair(progress, timeNow);
+    dirtyQuests.insert(questid);
+    availableQuestsOutdated = true;
+    sendQuestProgress(questid, progress);
+    questWriteLock = false;
+}
 
-    try {
-        UpdateQuery updQuery;
-        updQuery.addAssignColumn<TYPE_OF_QUESTSTATUS>("qpg_progress", progress);
-        updQuery.addAssignColumn<int>("qpg_time", timeNow);
-        updQuery.addEqualCondition<TYPE_OF_CHARACTER_ID>("questprogress", "qpg_userid", getId());
-        updQuery.addEqualCondition<TYPE_OF_QUEST_ID>("questprogress", "qpg_questid", questid);
-        updQuery.setServerTable("questprogress");
+auto Player::takeQuestChanges() -> QuestChanges {
+    QuestChanges changes;
+
+    // after a failed write it is unknown which quests made it, so all are written again
+    if (questFlushFailed->exchange(false)) {
+        changes.reserve(quests.size());
 
-        Result results = updQuery.execute();
+        for (const auto &[questId, status] : quests) {
+            changes.emplace_back(questId, status.first, status.second);
+        }
+    } else {
+        changes.reserve(dirtyQuests.size());
 
-        // TODO: Save player from dedicated thread only, see PlayerManager
-        // save();
+        for (const auto questId : dirtyQuests) {
+            const auto &[progress, changeTime] = quests.at(questId);
+            changes.emplace_back(questId, progress, changeTime);
+        }
+    }
 
-        if (results.affected_rows() == 0) {
-            InsertQuery insQuery;
-            const InsertQuery::columnIndex userColumn = insQuery.addColumn("qpg_userid");
-            const InsertQuery::columnIndex questColumn = insQuery.addColumn("qpg_questid");
-            const InsertQuery::columnIndex progressColumn = insQuery.addColumn("qpg_progress");
-            const InsertQuery::columnIndex timeColumn = insQuery.addColumn("qpg_time");
-            insQuery.addServerTable("questprogress");
+    dirtyQuests.clear();
+    return changes;
+}
 
-            insQuery.addValue<TYPE_OF_CHARACTER_ID>(userColumn, getId());
-            insQuery.addValue<TYPE_OF_QUEST_ID>(questColumn, questid);
-            insQuery.addValue<TYPE_OF_QUESTSTATUS>(progressColumn, progress);
-            insQuery.addValue<int>(timeColumn, timeNow);
+void Player::writeQuestChanges(const Database::PConnection &connection, TYPE_OF_CHARACTER_ID id,
+                               const QuestChanges &changes) {
+    using namespace Database;
 
-            insQuery.execute();
+    if (changes.empty()) {
+        return;
+    }
+
+    InsertQuery query(connection);
+    const auto userColumn = query.addColumn("qpg_userid");
+    const auto questColumn = query.addColumn("qpg_questid");
+    const auto progressColumn = query.addColumn("qpg_progress");
+    const auto timeColumn = query.addColumn("qpg_time");
+    query.addServerTable("questprogress");
+    query.onConflictUpdate({"qpg_userid", "qpg_questid"}, {"qpg_progress", "qpg_time"});
+
+    for (const auto &[questId, progress, changeTime] : changes) {
+        query.addValue<TYPE_OF_CHARACTER_ID>(userColumn, id);
+        query.addValue<TYPE_OF_QUEST_ID>(questColumn, questId);
+        query.addValue<TYPE_OF_QUESTSTATUS>(progressColumn, progress);
+        query.addValue<int>(timeColumn, changeTime);
+    }
+
+    query.execute();
+}
+
+void Player::flushQuestProgress() {
+    if (dirtyQuests.empty() && !*questFlushFailed) {
+        return;
+    }
+
+    auto job = [id = getId(), changes = takeQuestChanges(),
+                failed = questFlushFailed](const Database::PConnection &connection) {
+        try {
+            writeQuestChanges(connection, id, changes);
+        } catch (...) {
+            *failed = true;
+            throw;
         }
-    } catch (std::exception &e) {
-        Logger::error(LogFacility::Script)
-                << "Setting quest progress failed for " << to_string() << ": " << e.what() << Log::end;
-        connection->rollbackTransaction();
-        questWriteLock = false;
+    };
+
+    PersistenceQueue::get().push("quest progress of " + to_string(), std::move(job));
+}
+
+void Player::updateAvailableQuests() {
+    const auto quests = Data::quests().getQuestsInRange(getPosition(), getScreenRange());
+
+    if (!availableQuestsOutdated && ranges::equal(quests | ranges::views::keys, questsInRange)) {
         return;
     }
 
-    quests[questid] = std::make_pair(progress, timeNow);
-    sendQuestProgress(questid, progress);
-    questWriteLock = false;
+    sendAvailableQuests();
 }
 
 void Player::sendAvailableQuests() {
     const auto quests = Data::quests().getQuestsInRange(getPosition(), getScreenRange());
+    questsInRange = quests | ranges::views::keys | ranges::to<std::vector>();
+    availableQuestsOutdated = false;
     int someTime = 0;
     std::vector<position> questsAvailableNow;
     std::vector<position> questsAvailableSoon;
@@ -2443,6 +2493,7 @@ void Player::sendCharAppearance(TYPE_OF_CHARACTER_ID id, const ServerCommandPoin
 void Player::sendCharRemove(TYPE_OF_CHARACTER_ID id, const ServerCommandPointer &removechar) {
     if (this->getId() != id) {
         visibleChars.erase(id);
+        charsInView.erase(id);
         Connection->addCommand(removechar);
     }
 }
@@ -28,13 +28,16 @@
 #include "netinterface/NetInterface.hpp"
 #include "script/LuaScript.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <queue>
 #include <set>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 struct WeatherStruct;
 class Dialog;
@@ -165,6 +168,13 @@ public:
     // removes a Char from sight
     void sendCharRemove(TYPE_OF_CHARACTER_ID id, const ServerCommandPointer &removechar);
 
+    // characters on screen with the position last sent to the client
+    using CharsInView = std::unordered_map<TYPE_OF_CHARACTER_ID, position>;
+    [[nodiscard]] auto getCharsInView() const -> const CharsInView & { return charsInView; }
+    void setCharsInView(CharsInView &&chars) { charsInView = std::move(chars); }
+    void setCharInView(TYPE_OF_CHARACTER_ID id, const position &pos) { charsInView[id] = pos; }
+    void clearCharsInView() { charsInView.clear(); }
+
     /**
      *a long time needed action for the player
      */
@@ -465,13 +475,20 @@ public:
 
     void setQuestProgress(TYPE_OF_QUEST_ID questid, TYPE_OF_QUESTSTATUS progress) override;
     void sendAvailableQuests();
+    // only sends available quests if the quests in range or the quest progress changed since the last update
+    void updateAvailableQuests();
     void sendQuestProgress(TYPE_OF_QUEST_ID questId, TYPE_OF_QUESTSTATUS progress);
     void sendCompleteQuestProgress();
+    void flushQuestProgress();
     auto getQuestProgress(TYPE_OF_QUEST_ID questid, int &time) const -> TYPE_OF_QUESTSTATUS override;
 
 private:
     void handleWarp();
 
+    CharsInView charsInView;
+    std::vector<TYPE_OF_QUEST_ID> questsInRange;
+    bool availableQuestsOutdated = true;
+
     static constexpr auto dialogLimit = 100;
 
     template <class DialogType, class DialogCommandType> void requestDialog(DialogType *dialog) {
@@ -581,6 +598,15 @@ private:
     using QuestStatusTimePair = std::pair<TYPE_OF_QUESTSTATUS, int>;
     using QuestMap = std::unordered_map<TYPE_OF_QUEST_ID, QuestStatusTimePair>;
     QuestMap quests;
+    // quests changed since their progress was last queued for persistence
+    std::unordered_set<TYPE_OF_QUEST_ID> dirtyQuests;
+    // set by the persistence thread when a flush failed, shared since the player may be gone by then
+    std::shared_ptr<std::atomic_bool> questFlushFailed = std::make_shared<std::atomic_bool>(false);
+
+    using QuestChanges = std::vector<std::tuple<TYPE_OF_QUEST_ID, TYPE_OF_QUESTSTATUS, int>>;
+    auto takeQuestChanges() -> QuestChanges;
+    static void writeQuestChanges(const Database::PConnection &connection, TYPE_OF_CHARACTER_ID id,
+                                  const QuestChanges &changes);
 };
 
 #endif
@@ -91,6 +91,7 @@ void PlayerManager::loginLoop(PlayerManager *pmanager) {
             // loop
             int curconn = newplayers.size();
             unsigned short acceptVersion = Config::instance().clientversion;
+            unsigned short compressionVersion = Config::instance().compression_clientversion;
 
             for (int i = 0; i < curconn; ++i) {
                 auto Connection = newplayers.pop_front();
@@ -114,6 +115,10 @@ void PlayerManager::loginLoop(PlayerManager *pmanager) {
                                 throw Player::LogoutException(OLDCLIENT);
                             }
 
+                            if (compressionVersion != 0 && clientversion >= compressionVersion) {
+                                Connection->enableCompression();
+                            }
+
                             // TODO is this check really necessary?
                             if (loginData->getLoginName().empty() || loginData->getPassword().empty()) {
                                 throw Player::LogoutException(WRONGPWD);
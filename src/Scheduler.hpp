@@ -21,6 +21,7 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -56,6 +57,9 @@ public:
                           typename clock_type::time_point first_time, const std::string &taskname);
     void signalNewPlayerAction();
 
+    // task receiving the time left until the next task is due, run before waiting for it
+    void setIdleTask(std::function<void(std::chrono::nanoseconds)> task);
+
     void run_once(std::chrono::nanoseconds max_timeout);
 
 private:
@@ -65,6 +69,8 @@ private:
     std::mutex _new_action_signal_mutex;
     std::condition_variable _new_action_available_cond;
 
+    std::function<void(std::chrono::nanoseconds)> _idle_task;
+
     using task_container_t = std::priority_queue<Task<std::chrono::steady_clock>>;
     task_container_t _tasks;
     std::mutex _container_mutex;
@@ -65,6 +65,11 @@ void ClockBasedScheduler<clock_type>::signalNewPlayerAction() {
 	_new_action_available_cond.notify_all();
 }
 
+template<typename clock_type>
+void ClockBasedScheduler<clock_type>::setIdleTask(std::function<void(std::chrono::nanoseconds)> task) {
+	_idle_task = std::move(task);
+}
+
 template<typename clock_type>
 void ClockBasedScheduler<clock_type>::run_once(std::chrono::nanoseconds max_timeout) {
 	auto next_action_time = getNextTaskTime();
@@ -73,6 +78,12 @@ void ClockBasedScheduler<clock_type>::run_once(std::chrono::nanoseconds max_time
 
     }
 
+	if (_idle_task && next_action_time > std::chrono::nanoseconds::zero()) {
+		auto idle_start = clock_type::now();
+		_idle_task(next_action_time);
+		next_action_time -= clock_type::now() - idle_start;
+	}
+
 	{
 		std::unique_lock<std::mutex> lock(_new_action_signal_mutex);
 		_new_action_available_cond.wait_for(lock, next_action_time);
@@ -28,6 +28,7 @@
 #include "db/SelectQuery.hpp"
 #include "map/Field.hpp"
 
+#include <algorithm>
 #include <boost/cstdint.hpp>
 #include <range/v3/all.hpp>
 
@@ -104,6 +105,16 @@ void SpawnPoint::spawn() {
     }
 }
 
+auto SpawnPoint::getMaxMonsters() const -> size_t {
+    size_t count = 0;
+
+    for (const auto &spawn : SpawnTypes) {
+        count += std::max(spawn.max_count, 0);
+    }
+
+    return count;
+}
+
 void SpawnPoint::dead(TYPE_OF_CHARACTER_ID type) {
     for (auto &spawn : SpawnTypes) {
         if (spawn.typ == type) {
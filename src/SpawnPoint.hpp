@@ -51,6 +51,9 @@ public:
 
     [[nodiscard]] inline auto getRange() const -> Coordinate { return range; }
 
+    //! the number of monsters this spawnpoint keeps alive at most
+    [[nodiscard]] auto getMaxMonsters() const -> size_t;
+
 private:
     // our link to the world...
     World *world;
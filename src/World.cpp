@@ -24,6 +24,7 @@
 #include "Logger.hpp"
 #include "LongTimeAction.hpp"
 #include "Monster.hpp"
+#include "MonsterPool.hpp"
 #include "NPC.hpp"
 #include "Player.hpp"
 #include "PlayerManager.hpp"
@@ -43,6 +44,7 @@
 #include "netinterface/NetInterface.hpp"
 #include "netinterface/protocol/ServerCommands.hpp"
 #include "script/LuaNPCScript.hpp"
+#include "script/LuaScript.hpp"
 #include "script/server.hpp"
 #include "tuningConstants.hpp"
 
@@ -102,6 +104,7 @@ void World::turntheworld() {
         checkPlayers();
         checkMonsters();
         checkNPC();
+        checkLongTimeEffects();
     }
 }
 
@@ -123,8 +126,6 @@ void World::checkPlayers() {
                 player.increaseFightPoints(ap);
                 player.workoutCommands();
                 player.checkFightMode();
-                player.ltAction->checkAction();
-                player.effects.checkEffects();
                 auto timeSinceSave = now - player.lastsavetime;
 
                 if (!savedOnePlayer && timeSinceSave >= PLAYER_SAVE_INTERVAL) {
@@ -167,6 +168,40 @@ void World::checkPlayers() {
     }
 }
 
+void World::checkLongTimeEffects() {
+    effectQueue.advance();
+    time_t now = 0;
+    time(&now);
+
+    std::vector<TYPE_OF_CHARACTER_ID> postponed;
+
+    while (const auto id = effectQueue.popDue()) {
+        auto *character = findCharacter(*id);
+
+        if (character == nullptr) {
+            continue;
+        }
+
+        bool active = character->isAlive();
+
+        if (character->getType() == Character::player) {
+            const auto &player = dynamic_cast<Player &>(*character);
+            const long timeSinceKeepAlive = now - player.lastkeepalive;
+            active = player.Connection->online && timeSinceKeepAlive >= 0 && timeSinceKeepAlive <= CLIENT_TIMEOUT;
+        }
+
+        if (active) {
+            character->effects.checkEffects();
+        } else {
+            postponed.push_back(*id);
+        }
+    }
+
+    for (const auto id : postponed) {
+        effectQueue.schedule(effectQueue.now() + 1, id);
+    }
+}
+
 void World::checkPlayerImmediateCommands() {
     std::unique_lock<std::mutex> lock(immediatePlayerCommandsMutex);
     while (!immediatePlayerCommands.empty()) {
@@ -228,6 +263,14 @@ auto World::initRespawns() -> bool {
                 Logger::debug(LogFacility::World) << "added spawnpoint " << pos << Log::end;
             }
 
+            size_t spawnCapacity = 0;
+
+            for (const auto &spawn : SpawnList) {
+                spawnCapacity += spawn.getMaxMonsters();
+            }
+
+            MonsterPool::reserve(spawnCapacity);
+
         } else {
             return false;
         }
@@ -267,38 +310,26 @@ void World::checkMonsters() {
         if (monster.isAlive()) {
             monster.increaseActionPoints(ap);
             monster.increaseFightPoints(ap);
-            monster.effects.checkEffects();
 
             if (monster.canAct()) {
                 if (!isPlayerNearby(monster) && !monster.getOnRoute()) {
                     return;
                 }
 
-                bool foundMonster = monsterDescriptions->exists(monster.getMonsterType());
-                const auto &monStruct = (*monsterDescriptions)[monster.getMonsterType()];
+                const auto &profile = monster.getCombatProfile();
+                const bool foundMonster = profile.hasDefinition;
 
                 if (!monster.getOnRoute()) {
                     if (monster.getPosition() == monster.lastTargetPosition) {
                         monster.lastTargetSeen = false;
                     }
 
-                    Item itl = monster.GetItemAt(LEFT_TOOL).cloneItem();
-                    Item itr = monster.GetItemAt(RIGHT_TOOL).cloneItem();
-
-                    uint16_t range = 1;
-
-                    if (Data::weaponItems().exists(itr.getId())) {
-                        range = Data::weaponItems()[itr.getId()].Range;
-                    } else if (Data::weaponItems().exists(itl.getId())) {
-                        range = Data::weaponItems()[itl.getId()].Range;
-                    }
-
-                    const auto temp = getTargetsInRange(monster.getPosition(), range);
+                    const auto temp = getTargetsInRange(monster.getPosition(), profile.range);
                     bool has_attacked = false;
                     Character *target = nullptr;
 
                     if ((!temp.empty()) && monster.canAttack()) {
-                        if (!monStruct.script || !monStruct.script->setTarget(monsterPointer, temp, target)) {
+                        if (!profile.script || !profile.script->setTarget(monsterPointer, temp, target)) {
                             target = script::server::fighting().setTarget(monsterPointer, temp);
                         }
 
@@ -309,8 +340,8 @@ void World::checkMonsters() {
                             monster.lastTargetSeen = true;
 
                             if (foundMonster) {
-                                if (monStruct.script) {
-                                    if (monStruct.script->enemyNear(monsterPointer, target)) {
+                                if (profile.script) {
+                                    if (profile.script->enemyNear(monsterPointer, target)) {
                                         return;
                                     }
                                 }
@@ -337,8 +368,8 @@ void World::checkMonsters() {
                         if ((!targets.empty()) && (monster.canAttack())) {
                             Character *targetChar = nullptr;
 
-                            if (!monStruct.script ||
-                                !monStruct.script->setTarget(monsterPointer, targets, targetChar)) {
+                            if (!profile.script ||
+                                !profile.script->setTarget(monsterPointer, targets, targetChar)) {
                                 targetChar = script::server::fighting().setTarget(monsterPointer, targets);
                             }
 
@@ -347,8 +378,8 @@ void World::checkMonsters() {
                                 monster.lastTargetPosition = targetChar->getPosition();
 
                                 if (foundMonster) {
-                                    if (monStruct.script) {
-                                        if (monStruct.script->enemyOnSight(monsterPointer, targetChar)) {
+                                    if (profile.script) {
+                                        if (profile.script->enemyOnSight(monsterPointer, targetChar)) {
                                             return;
                                         }
                                     }
@@ -368,16 +399,13 @@ void World::checkMonsters() {
                         if (canMakeRandomStep) {
                             bool makesRandomStep = Random::uniform() < randomMonsterMoveProbability;
 
-                            bool hasDefinition = monsterDescriptions->exists(monster.getMonsterType());
-                            const auto &monsterdef = (*monsterDescriptions)[monster.getMonsterType()];
-
-                            if (!hasDefinition) {
+                            if (!foundMonster) {
                                 Logger::error(LogFacility::World)
                                         << "Data for Healing not Found for monsterrace: " << monster.getMonsterType()
                                         << Log::end;
                             }
 
-                            if (makesRandomStep && hasDefinition && monsterdef.canselfheal) {
+                            if (makesRandomStep && profile.canSelfHeal) {
                                 monster.heal();
                             } else {
                                 SpawnPoint *spawn = monster.getSpawn();
@@ -463,29 +491,18 @@ void World::checkMonsters() {
                         }
                     }
                 } else {
-                    Item itl = monster.GetItemAt(LEFT_TOOL).cloneItem();
-                    Item itr = monster.GetItemAt(RIGHT_TOOL).cloneItem();
-
-                    uint16_t range = 1;
-
-                    if (Data::weaponItems().exists(itr.getId())) {
-                        range = Data::weaponItems()[itr.getId()].Range;
-                    } else if (Data::weaponItems().exists(itl.getId())) {
-                        range = Data::weaponItems()[itl.getId()].Range;
-                    }
-
-                    const auto temp = getTargetsInRange(monster.getPosition(), range);
+                    const auto temp = getTargetsInRange(monster.getPosition(), profile.range);
 
                     if (!temp.empty()) {
                         Character *target = nullptr;
 
-                        if (!monStruct.script || !monStruct.script->setTarget(monsterPointer, temp, target)) {
+                        if (!profile.script || !profile.script->setTarget(monsterPointer, temp, target)) {
                             target = script::server::fighting().setTarget(monsterPointer, temp);
                         }
 
                         if (target != nullptr) {
-                            if (foundMonster && monStruct.script) {
-                                monStruct.script->enemyNear(monsterPointer, target);
+                            if (foundMonster && profile.script) {
+                                profile.script->enemyNear(monsterPointer, target);
                             } else {
                                 Logger::error(LogFacility::World)
                                         << "cant find a monster id for checking the script!" << Log::end;
@@ -498,13 +515,13 @@ void World::checkMonsters() {
                     if (!temp2.empty()) {
                         Character *target = nullptr;
 
-                        if (!monStruct.script || !monStruct.script->setTarget(monsterPointer, temp2, target)) {
+                        if (!profile.script || !profile.script->setTarget(monsterPointer, temp2, target)) {
                             target = script::server::fighting().setTarget(monsterPointer, temp2);
                         }
 
                         if (target != nullptr) {
-                            if (foundMonster && monStruct.script) {
-                                monStruct.script->enemyOnSight(monsterPointer, target);
+                            if (foundMonster && profile.script) {
+                                profile.script->enemyOnSight(monsterPointer, target);
                             }
                         }
                     }
@@ -512,8 +529,8 @@ void World::checkMonsters() {
                     if (!monster.waypoints.makeMove()) {
                         monster.setOnRoute(false);
 
-                        if (foundMonster && monStruct.script) {
-                            monStruct.script->abortRoute(monsterPointer);
+                        if (foundMonster && profile.script) {
+                            profile.script->abortRoute(monsterPointer);
                         } else {
                             Logger::notice(LogFacility::Script)
                                     << "cant find the monster id for calling a script!" << Log::end;
@@ -535,12 +552,10 @@ void World::checkMonsters() {
 
         sendCharacterMoveToAllVisiblePlayers(monster, NORMALMOVE, 4);
 
-        const auto monsterType = monster->getMonsterType();
-        bool foundMonster = monsterDescriptions->exists(monsterType);
-        const auto &monStruct = (*monsterDescriptions)[monsterType];
+        const auto &profile = monster->getCombatProfile();
 
-        if (foundMonster && monStruct.script) {
-            monStruct.script->onSpawn(monster);
+        if (profile.hasDefinition && profile.script) {
+            profile.script->onSpawn(monster);
         }
     }
 
@@ -567,7 +582,6 @@ void World::checkNPC() {
     Npc.for_each([this](NPC *npc) {
         if (npc->isAlive()) {
             npc->increaseActionPoints(ap);
-            npc->effects.checkEffects();
 
             if (!isPlayerNearby(*npc) && !npc->getOnRoute()) {
                 return;
@@ -631,6 +645,8 @@ static auto getNextIGDayTime() -> std::chrono::steady_clock::time_point {
 }
 
 void World::initScheduler() {
+    saveOnlinePlayerList();
+
     auto reduceMC = [](Character *character) {
         if (character->getMentalCapacity() > 0) {
             script::server::learn().reduceMC(character);
@@ -654,6 +670,17 @@ void World::initScheduler() {
     scheduler.addRecurringTask([&] { turntheworld(); }, gameLoopInterval, "turntheworld");
     scheduler.addRecurringTask([&] { sendIGTimeToAllPlayers(); }, ingameTimeUpdateInterval, getNextIGDayTime(),
                                "update_ig_day");
+    scheduler.addRecurringTask([&] { Players.for_each([](Player *player) { player->flushQuestProgress(); }); },
+                               questProgressFlushInterval, "flush_quest_progress");
+    scheduler.addRecurringTask([] { Data::scriptVariables().save(); }, scriptVariablesFlushInterval,
+                               "flush_script_variables");
+    scheduler.addRecurringTask([&] { saveOnlinePlayerChanges(); }, onlinePlayerListInterval,
+                               "save_online_player_changes");
+    scheduler.addRecurringTask([&] { saveOnlinePlayerList(); }, onlinePlayerListReconcileInterval,
+                               "reconcile_online_player_list");
+    scheduler.setIdleTask([](std::chrono::nanoseconds idleTime) {
+        LuaScript::collectGarbage(std::min<std::chrono::nanoseconds>(idleTime / 2, luaGarbageCollectionSlice));
+    });
 }
 
 auto World::executeUserCommand(Player *user, const std::string &input, const CommandMap &commands) -> bool {
@@ -26,6 +26,7 @@
 #include "Character.hpp"
 #include "CharacterContainer.hpp"
 #include "Language.hpp"
+#include "LongTimeEffectQueue.hpp"
 #include "MonitoringClients.hpp"
 #include "NewClientView.hpp"
 #include "Scheduler.hpp"
@@ -42,6 +43,7 @@
 #include <list>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 
 class Player;
 class Monster;
@@ -165,6 +167,11 @@ public:
 
     ClockBasedScheduler<std::chrono::steady_clock> scheduler;
 
+    /**
+     * clock of all long time effects and the characters waiting for their next effect
+     */
+    LongTimeEffectQueue effectQueue;
+
     WeatherStruct weather; /**< a struct to the weather @see WeatherStruct */
 
     /**
@@ -197,6 +204,11 @@ public:
      */
     void checkPlayers();
 
+    /**
+     * advances the long time effect clock and calls the effects which are due
+     */
+    void checkLongTimeEffects();
+
     void invalidatePlayerDialogs() const;
 
     /**
@@ -250,9 +262,10 @@ public:
     inline void setCurrentScript(LuaScript *script) { currentScript = script; }
 
     /**
-     *saves all online players a table in the db
+     * marks the table of online players in the db as outdated,
+     * changes are written incrementally by the scheduler
      */
-    void updatePlayerList() const;
+    void updatePlayerList();
 
     /**
      * finds all warpfields in a given range
@@ -328,6 +341,15 @@ public:
      */
     void sendAllVisibleCharactersToPlayer(Player *cp, bool sendSpin);
 
+    /**
+     *sends only the characters which entered the screen of a player or
+     *changed their position without the player being informed
+     *
+     *@param cp pointer to the player which should recive the data
+     *@param sendSpin if true the direction of the entering chars is also sent
+     */
+    void sendEnteringCharactersToPlayer(Player *cp, bool sendSpin);
+
     /**
      *adds a warpfield to a specific groundtile
      *
@@ -378,9 +400,10 @@ public:
      *calls a triggerscript if a character is moving to a triggerfield or away from one
      *
      *@param cc the character which is moving
+     *@param field the field the character is moving to or away from
      *@param true if the char is moving to the field, false if he is moving away from the field
      */
-    static void triggerFieldMove(Character *cc, bool moveto);
+    static void triggerFieldMove(Character *cc, const map::Field &field, bool moveto);
 
     /**
      * update the character container about the position change
@@ -422,7 +445,10 @@ public:
                                               TYPE_OF_WALKINGCOST duration) const;
     void sendCharacterMoveToAllVisibleChars(Character *cc, TYPE_OF_WALKINGCOST duration) const;
     void sendCharacterWarpToAllVisiblePlayers(Character *cc, const position &oldpos, unsigned char moveType) const;
-    template <class T> void sendCharsInVector(const std::vector<T *> &vec, Player *cp, bool sendSpin);
+    void sendCharsInScreen(Player *cp, bool sendSpin);
+    template <class T>
+    void sendCharsInVector(const std::vector<T *> &vec, Player *cp, bool sendSpin,
+                           std::unordered_map<TYPE_OF_CHARACTER_ID, position> &inView);
 
     void lookAtMapItem(Player *player, const position &pos, uint8_t stackPos);
 
@@ -724,6 +750,12 @@ private:
 
     Timer monstertimer{std::chrono::minutes(1)};
 
+    // online players as last queued for the onlineplayer table
+    std::unordered_set<TYPE_OF_CHARACTER_ID> savedOnlinePlayers;
+    bool onlinePlayersChanged = false;
+    void saveOnlinePlayerChanges();
+    void saveOnlinePlayerList();
+
     void ageMaps();
     void ageInventory() const;
 
@@ -756,6 +788,9 @@ private:
     // Describe to admin tile in front of them
     void what_command(Player *cp);
 
+    // Show runtime statistics of the server
+    static void stats_command(Player *cp);
+
     // Save all online players
     void playersave_command(Player *cp) const;
 
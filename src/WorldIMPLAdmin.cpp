@@ -19,6 +19,7 @@
 #include "Config.hpp"
 #include "Logger.hpp"
 #include "Monster.hpp"
+#include "MonsterPool.hpp"
 #include "Player.hpp"
 #include "PlayerManager.hpp"
 #include "World.hpp"
@@ -30,9 +31,11 @@
 #include "data/ScheduledScriptsTable.hpp"
 #include "globals.hpp"
 #include "map/Field.hpp"
+#include "netinterface/ClientCommandPool.hpp"
 #include "netinterface/NetInterface.hpp"
 #include "netinterface/protocol/ServerCommands.hpp"
 #include "script/LuaReloadScript.hpp"
+#include "script/LuaScript.hpp"
 #include "script/server.hpp"
 
 #include <iostream>
@@ -56,6 +59,11 @@ void World::InitGMCommands() {
         return true;
     };
 
+    GMCommands["stats"] = [](World *world, Player *player, const std::string & /*unused*/) -> bool {
+        stats_command(player);
+        return true;
+    };
+
     GMCommands["?"] = [](World *world, Player *player, const std::string & /*unused*/) -> bool {
         gmhelp_command(player);
         return true;
@@ -434,7 +442,7 @@ void World::makeVisible(Player *cp) const {
 
     for (const auto &player : Players.findAllCharactersInScreen(cp->getPosition())) {
         if (cp != player) {
-            ServerCommandPointer cmd = std::make_shared<MoveAckTC>(cp->getId(), cp->getPosition(), PUSH, 0);
+            ServerCommandPointer cmd = std::make_shared<MoveAckTC>(cp->getId(), cp->getPosition(), PUSH, 0, true);
             player->Connection->addCommand(cmd);
         }
     }
@@ -499,6 +507,7 @@ void World::forceLogoutOfAllPlayers() {
     });
 
     Players.clear();
+    saveOnlinePlayerList();
 }
 
 auto World::forceLogoutOfPlayer(const std::string &name) const -> bool {
@@ -813,6 +822,84 @@ void World::what_command(Player *cp) {
     }
 }
 
+void World::stats_command(Player *cp) {
+    if (!cp->hasGMRight(gmr_basiccommands)) {
+        return;
+    }
+
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+
+    std::stringstream message;
+    constexpr size_t bytesPerKilobyte = 1024;
+    message << "- Lua heap " << LuaScript::getMemoryUsage() / bytesPerKilobyte << " KiB, idle collection "
+            << duration_cast<milliseconds>(LuaScript::getGarbageCollectionTime()).count() << " ms";
+    cp->inform(message.str());
+
+    const auto &allocator = LuaScript::getAllocator();
+    message.str("");
+    message << "- Lua allocator " << allocator.getUsage() / bytesPerKilobyte << " KiB";
+
+    if (allocator.getLimit() > 0) {
+        message << " of " << allocator.getLimit() / bytesPerKilobyte << " KiB";
+    }
+
+    message << ", " << allocator.getLargeBlocks() << " large blocks, " << allocator.getFailedAllocations()
+            << " failed";
+    cp->inform(message.str());
+
+    for (const auto &sizeClass : allocator.getSizeClassStats()) {
+        message.str("");
+        message << "-- " << sizeClass.blockSize << " bytes: " << sizeClass.blocksInUse << " of "
+                << sizeClass.blocksReserved << " in use, " << sizeClass.allocations << " allocations";
+        cp->inform(message.str());
+    }
+
+    const auto commands = ClientCommandPool::getStats();
+    message.str("");
+    message << "- Client commands " << commands.commands << ", " << commands.blockAllocations << " object and "
+            << commands.bufferAllocations << " buffer allocations";
+    cp->inform(message.str());
+
+    const auto monsters = MonsterPool::getStats();
+    message.str("");
+    message << "- Monsters " << monsters.monsters << " spawned, " << monsters.blockAllocations << " allocations, "
+            << monsters.blocksInUse << " alive (peak " << monsters.peakBlocksInUse << "), " << monsters.freeBlocks
+            << " pooled";
+    cp->inform(message.str());
+
+    const auto compression = CompressedTC::getStats();
+    message.str("");
+    message << "- Compressed commands " << compression.commands << ", "
+            << compression.uncompressedBytes / bytesPerKilobyte << " KiB to "
+            << compression.compressedBytes / bytesPerKilobyte << " KiB";
+    cp->inform(message.str());
+
+    size_t queuedBytes = 0;
+    size_t maxQueuedBytes = 0;
+    std::string maxQueuedPlayer;
+    World::get()->Players.for_each([&](Player *player) {
+        const auto bytes = player->Connection->getQueuedBytes();
+        queuedBytes += bytes;
+
+        if (bytes > maxQueuedBytes) {
+            maxQueuedBytes = bytes;
+            maxQueuedPlayer = player->to_string();
+        }
+    });
+
+    message.str("");
+    message << "- Send queues " << queuedBytes / bytesPerKilobyte << " KiB";
+
+    if (maxQueuedBytes > 0) {
+        message << ", largest " << maxQueuedBytes / bytesPerKilobyte << " KiB for " << maxQueuedPlayer;
+    }
+
+    message << ", " << NetInterface::getCoalescedCommands() << " superseded commands dropped, "
+            << NetInterface::getSlowClientDisconnects() << " slow clients disconnected";
+    cp->inform(message.str());
+}
+
 void World::playersave_command(Player *cp) const {
     if (!cp->hasGMRight(gmr_save)) {
         return;
@@ -881,6 +968,8 @@ void World::gmhelp_command(Player *cp) {
         cp->inform(tmessage);
         tmessage = "!who [<player>] - List all players online or a single player if specified.";
         cp->inform(tmessage);
+        tmessage = "!stats - shows runtime statistics of the server.";
+        cp->inform(tmessage);
         tmessage = "!forceintroduce <char id|char name> - (!fi) introduces the char to all gms in range.";
         cp->inform(tmessage);
         tmessage = "!forceintroduceall - (!fia) introduces all chars in sight to you.";
@@ -1021,6 +1110,7 @@ auto World::reload_defs(Player *cp) const -> bool {
     if (ok) {
         QuestNodeTable::getInstance().reload();
         ok = Data::reload();
+        Monster::invalidateCombatProfiles();
     }
 
     if (ok) {
@@ -1055,6 +1145,7 @@ auto World::reload_defs(Player *cp) const -> bool {
         // Mutex für login logout sperren so das aktuell keiner mehr einloggen kann
         PlayerManager::setLoginLogout(true);
         monsterDescriptions = std::move(monsterDescriptionsTemp);
+        Monster::invalidateCombatProfiles();
         raceTypes = std::move(raceTypesTemp);
         scheduledScripts = std::move(scheduledScriptsTemp);
         // Mutex entsperren.
@@ -51,8 +51,8 @@ void World::checkFieldAfterMove(Character *character, const map::Field &field) {
         }
     }
 
-    if (character->isAlive() && Data::triggers().exists(character->getPosition())) {
-        const auto &script = Data::triggers().script(character->getPosition());
+    if (character->isAlive() && field.hasTrigger()) {
+        const auto &script = Data::triggers().script(field.getPosition());
 
         if (script) {
             script->CharacterOnField(character);
@@ -60,9 +60,9 @@ void World::checkFieldAfterMove(Character *character, const map::Field &field) {
     }
 }
 
-void World::triggerFieldMove(Character *cc, bool moveto) {
-    if ((cc != nullptr) && cc->isAlive() && Data::triggers().exists(cc->getPosition())) {
-        const auto &script = Data::triggers().script(cc->getPosition());
+void World::triggerFieldMove(Character *cc, const map::Field &field, bool moveto) {
+    if ((cc != nullptr) && cc->isAlive() && field.hasTrigger()) {
+        const auto &script = Data::triggers().script(field.getPosition());
 
         if (script) {
             if (moveto) {
@@ -105,8 +105,9 @@ void World::sendPassiveMoveToAllVisiblePlayers(Character *ccp) const {
         Coordinate zoffs = charPos.z - playerPos.z + RANGEDOWN;
 
         if ((xoffs != 0) || (yoffs != 0) || (zoffs != RANGEDOWN)) {
-            ServerCommandPointer cmd = std::make_shared<MoveAckTC>(ccp->getId(), charPos, PUSH, 0);
+            ServerCommandPointer cmd = std::make_shared<MoveAckTC>(ccp->getId(), charPos, PUSH, 0, true);
             p->Connection->addCommand(cmd);
+            p->setCharInView(ccp->getId(), charPos);
         }
     }
 }
@@ -127,8 +128,9 @@ void World::sendCharacterMoveToAllVisiblePlayers(Character *cc, unsigned char mo
             Coordinate zoffs = charPos.z - playerPos.z + RANGEDOWN;
 
             if ((xoffs != 0) || (yoffs != 0) || (zoffs != RANGEDOWN)) {
-                ServerCommandPointer cmd = std::make_shared<MoveAckTC>(cc->getId(), charPos, moveType, duration);
+                ServerCommandPointer cmd = std::make_shared<MoveAckTC>(cc->getId(), charPos, moveType, duration, true);
                 p->Connection->addCommand(cmd);
+                p->setCharInView(cc->getId(), charPos);
             }
         }
     }
@@ -148,31 +150,48 @@ void World::sendCharacterWarpToAllVisiblePlayers(Character *cc, const position &
 
         for (const auto &p : Players.findAllCharactersInScreen(cc->getPosition())) {
             if (cc != p) {
-                ServerCommandPointer cmd = std::make_shared<MoveAckTC>(cc->getId(), cc->getPosition(), PUSH, 0);
+                ServerCommandPointer cmd = std::make_shared<MoveAckTC>(cc->getId(), cc->getPosition(), PUSH, 0, true);
                 p->Connection->addCommand(cmd);
+                p->setCharInView(cc->getId(), cc->getPosition());
             }
         }
     }
 }
 
 void World::sendAllVisibleCharactersToPlayer(Player *cp, bool sendSpin) {
+    cp->clearCharsInView();
+    sendCharsInScreen(cp, sendSpin);
+    cp->sendAvailableQuests();
+}
+
+void World::sendEnteringCharactersToPlayer(Player *cp, bool sendSpin) {
+    sendCharsInScreen(cp, sendSpin);
+    cp->updateAvailableQuests();
+}
+
+void World::sendCharsInScreen(Player *cp, bool sendSpin) {
     Range range;
     range.radius = cp->getScreenRange();
+    Player::CharsInView inView;
 
     std::vector<Player *> tempP = Players.findAllCharactersInRangeOf(cp->getPosition(), range);
-    sendCharsInVector<Player>(tempP, cp, sendSpin);
+    sendCharsInVector<Player>(tempP, cp, sendSpin, inView);
 
     std::vector<Monster *> tempM = Monsters.findAllCharactersInRangeOf(cp->getPosition(), range);
-    sendCharsInVector<Monster>(tempM, cp, sendSpin);
+    sendCharsInVector<Monster>(tempM, cp, sendSpin, inView);
 
     std::vector<NPC *> tempN = Npc.findAllCharactersInRangeOf(cp->getPosition(), range);
-    sendCharsInVector<NPC>(tempN, cp, sendSpin);
+    sendCharsInVector<NPC>(tempN, cp, sendSpin, inView);
 
-    cp->sendAvailableQuests();
+    // characters which left the screen are dropped, so they are sent again when reentering
+    cp->setCharsInView(std::move(inView));
 }
 
-template <class T> void World::sendCharsInVector(const std::vector<T *> &vec, Player *cp, bool sendSpin) {
+template <class T>
+void World::sendCharsInVector(const std::vector<T *> &vec, Player *cp, bool sendSpin,
+                              std::unordered_map<TYPE_OF_CHARACTER_ID, position> &inView) {
     const auto &playerPos = cp->getPosition();
+    const auto &previouslyInView = cp->getCharsInView();
 
     for (const auto &cc : vec) {
         if (!cc->isInvisible()) {
@@ -182,7 +201,14 @@ template <class T> void World::sendCharsInVector(const std::vector<T *> &vec, Pl
             const auto zoffs = charPos.z - playerPos.z + RANGEDOWN;
 
             if ((xoffs != 0) || (yoffs != 0) || (zoffs != RANGEDOWN)) {
-                ServerCommandPointer cmd = std::make_shared<MoveAckTC>(cc->getId(), charPos, PUSH, 0);
+                inView.emplace(cc->getId(), charPos);
+
+                if (const auto known = previouslyInView.find(cc->getId());
+                    known != previouslyInView.end() && known->second == charPos) {
+                    continue;
+                }
+
+                ServerCommandPointer cmd = std::make_shared<MoveAckTC>(cc->getId(), charPos, PUSH, 0, true);
                 cp->Connection->addCommand(cmd);
                 cmd = std::make_shared<PlayerSpinTC>(cc->getFaceTo(), cc->getId());
 
@@ -440,7 +440,7 @@ auto World::takeItemFromMap(Character *cc, const position &itemPosition) -> bool
                     }
                 }
 
-                if (Data::triggers().exists(itemPosition)) {
+                if (field.hasTrigger()) {
                     const auto &script = Data::triggers().script(itemPosition);
 
                     if (script) {
@@ -517,7 +517,7 @@ auto World::putItemOnMap(Character *cc, const position &itemPosition) -> bool {
             if (field.addContainerOnStackIfWalkable(g_item, g_cont)) {
                 sendPutItemOnMapToAllVisibleCharacters(itemPosition, g_item);
 
-                if ((cc != nullptr) && Data::triggers().exists(itemPosition)) {
+                if ((cc != nullptr) && field.hasTrigger()) {
                     const auto &script = Data::triggers().script(itemPosition);
 
                     if (script) {
@@ -538,7 +538,7 @@ auto World::putItemOnMap(Character *cc, const position &itemPosition) -> bool {
             if (field.addItemOnStackIfWalkable(g_item)) {
                 sendPutItemOnMapToAllVisibleCharacters(itemPosition, g_item);
 
-                if ((cc != nullptr) && Data::triggers().exists(itemPosition)) {
+                if ((cc != nullptr) && field.hasTrigger()) {
                     const auto &script = Data::triggers().script(itemPosition);
 
                     if (script) {
@@ -575,7 +575,7 @@ auto World::putItemAlwaysOnMap(Character *cc, const position &itemPosition) -> b
             if (field.addContainerOnStack(g_item, g_cont)) {
                 sendPutItemOnMapToAllVisibleCharacters(itemPosition, g_item);
 
-                if ((cc != nullptr) && Data::triggers().exists(itemPosition)) {
+                if ((cc != nullptr) && field.hasTrigger()) {
                     const auto &script = Data::triggers().script(itemPosition);
 
                     if (script) {
@@ -596,7 +596,7 @@ auto World::putItemAlwaysOnMap(Character *cc, const position &itemPosition) -> b
             if (field.addItemOnStack(g_item)) {
                 sendPutItemOnMapToAllVisibleCharacters(itemPosition, g_item);
 
-                if ((cc != nullptr) && Data::triggers().exists(itemPosition)) {
+                if ((cc != nullptr) && field.hasTrigger()) {
                     const auto &script = Data::triggers().script(itemPosition);
 
                     if (script) {
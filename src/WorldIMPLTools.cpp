@@ -20,6 +20,7 @@
 
 #include "Monster.hpp"
 #include "NPC.hpp"
+#include "PersistenceQueue.hpp"
 #include "Player.hpp"
 #include "World.hpp"
 #include "data/ArmorObjectTable.hpp"
@@ -246,33 +247,92 @@ auto World::blockingLineOfSight(const position &startingpos, const position &end
 }
 
 // function which updates the playerlist.
-void World::updatePlayerList() const {
-    using namespace Database;
+void World::updatePlayerList() { onlinePlayersChanged = true; }
 
-    PConnection connection = ConnectionManager::getInstance().getConnection();
+void World::saveOnlinePlayerChanges() {
+    if (!onlinePlayersChanged) {
+        return;
+    }
+
+    onlinePlayersChanged = false;
+
+    std::vector<TYPE_OF_CHARACTER_ID> joined;
+    std::vector<TYPE_OF_CHARACTER_ID> left;
+    std::unordered_set<TYPE_OF_CHARACTER_ID> online;
+
+    Players.for_each([&](Player *player) {
+        online.insert(player->getId());
+
+        if (savedOnlinePlayers.count(player->getId()) == 0) {
+            joined.push_back(player->getId());
+        }
+    });
+
+    for (const auto id : savedOnlinePlayers) {
+        if (online.count(id) == 0) {
+            left.push_back(id);
+        }
+    }
+
+    savedOnlinePlayers = std::move(online);
 
-    try {
+    if (joined.empty() && left.empty()) {
+        return;
+    }
+
+    PersistenceQueue::get().push("online player changes", [joined, left](const Database::PConnection &connection) {
+        using namespace Database;
+        connection->beginTransaction();
+
+        if (!left.empty()) {
+            DeleteQuery delQuery(connection);
+            delQuery.addInCondition<TYPE_OF_CHARACTER_ID>("onlineplayer", "on_playerid", left);
+            delQuery.setServerTable("onlineplayer");
+            delQuery.execute();
+        }
+
+        if (!joined.empty()) {
+            InsertQuery insQuery(connection);
+            insQuery.setServerTable("onlineplayer");
+            const InsertQuery::columnIndex column = insQuery.addColumn("on_playerid");
+            insQuery.addValues<TYPE_OF_CHARACTER_ID>(column, joined);
+            insQuery.onConflictIgnore();
+            insQuery.execute();
+        }
+
+        connection->commitTransaction();
+    });
+}
+
+void World::saveOnlinePlayerList() {
+    onlinePlayersChanged = false;
+    savedOnlinePlayers.clear();
+
+    std::vector<TYPE_OF_CHARACTER_ID> online;
+
+    Players.for_each([&](Player *player) {
+        online.push_back(player->getId());
+        savedOnlinePlayers.insert(player->getId());
+    });
+
+    PersistenceQueue::get().push("online player list", [online](const Database::PConnection &connection) {
+        using namespace Database;
         connection->beginTransaction();
 
         DeleteQuery delQuery(connection);
         delQuery.setServerTable("onlineplayer");
         delQuery.execute();
 
-        if (!Players.empty()) {
+        if (!online.empty()) {
             InsertQuery insQuery(connection);
             insQuery.setServerTable("onlineplayer");
             const InsertQuery::columnIndex column = insQuery.addColumn("on_playerid");
-
-            Players.for_each([&](Player *player) { insQuery.addValue<TYPE_OF_CHARACTER_ID>(column, player->getId()); });
-
+            insQuery.addValues<TYPE_OF_CHARACTER_ID>(column, online);
             insQuery.execute();
         }
 
         connection->commitTransaction();
-    } catch (std::exception &e) {
-        Logger::error(LogFacility::World) << "Exception during saving online player list: " << e.what() << Log::end;
-        connection->rollbackTransaction();
-    }
+    });
 }
 
 auto World::findCharacterOnField(const position &pos) const -> Character * {
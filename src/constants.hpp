@@ -70,6 +70,7 @@ constexpr auto FLAG_MAKEPASSABLE = 8;
 constexpr auto FLAG_MONSTERONFIELD = 16;
 constexpr auto FLAG_NPCONFIELD = 32;
 constexpr auto FLAG_PLAYERONFIELD = 64;
+constexpr auto FLAG_TRIGGERFIELD = 128;
 
 // Verwendung siehe Tabelle:
 // WERT|      tiles        |   tilesmoditems   |       flags        |
@@ -88,7 +89,7 @@ constexpr auto FLAG_PLAYERONFIELD = 64;
 // ----+-------------------+-------------------+--------------------+
 // 064 |                   |                   |FLAG_PLAYERONFIELD  |
 // ----+-------------------+-------------------+--------------------+
-// 128 |                   |                   |                    |
+// 128 |                   |                   |FLAG_TRIGGERFIELD   |
 // ----+-------------------+-------------------+--------------------+
 
 //! das Verzeichnis der Karte, relativ zum DEFAULTMUDDIR
@@ -28,11 +28,48 @@
 #include "db/Result.hpp"
 #include "db/SelectQuery.hpp"
 
+#include <chrono>
+#include <map>
 #include <optional>
 
+namespace {
+
+auto itemSlotFromName(const std::string &position) -> std::optional<uint16_t> {
+    static const std::map<std::string, uint16_t, std::less<>> slots = {{"head", HEAD},
+                                                                       {"neck", NECK},
+                                                                       {"breast", BREAST},
+                                                                       {"hands", HANDS},
+                                                                       {"left hand", LEFT_TOOL},
+                                                                       {"right hand", RIGHT_TOOL},
+                                                                       {"left finger", FINGER_LEFT_HAND},
+                                                                       {"right finger", FINGER_RIGHT_HAND},
+                                                                       {"legs", LEGS},
+                                                                       {"feet", FEET},
+                                                                       {"coat", COAT},
+                                                                       {"belt1", BELT1},
+                                                                       {"belt2", BELT2},
+                                                                       {"belt3", BELT3},
+                                                                       {"belt4", BELT4},
+                                                                       {"belt5", BELT5},
+                                                                       {"belt6", BELT6}};
+
+    if (const auto it = slots.find(position); it != slots.end()) {
+        return it->second;
+    }
+
+    return std::nullopt;
+}
+
+} // namespace
+
 MonsterTable::MonsterTable() {
     Logger::info(LogFacility::Other) << "MonsterTable::constructor" << Log::end;
 
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+    using std::chrono::steady_clock;
+    const auto startTime = steady_clock::now();
+
     try {
         using namespace Database;
         PConnection connection = ConnectionManager::getInstance().getConnection();
@@ -121,187 +158,165 @@ MonsterTable::MonsterTable() {
                     ++questItr;
                 }
 
-                SelectQuery monAttrQuery(connection);
-                monAttrQuery.addColumn("monster_attributes", "mobattr_name");
-                monAttrQuery.addColumn("monster_attributes", "mobattr_min");
-                monAttrQuery.addColumn("monster_attributes", "mobattr_max");
-                monAttrQuery.addEqualCondition("monster_attributes", "mobattr_monsterid", id);
-                monAttrQuery.addServerTable("monster_attributes");
-
-                Database::Result monAttrResults = monAttrQuery.execute();
-
-                for (const auto &attrRow : monAttrResults) {
-                    const auto attribute = attrRow["mobattr_name"].as<std::string>("");
-                    auto minValue = attrRow["mobattr_min"].as<uint16_t>();
-                    auto maxValue = attrRow["mobattr_max"].as<uint16_t>();
-
-                    if (attribute == "luck") {
-                        temprecord.attributes.luck = std::make_pair(minValue, maxValue);
-                    } else if (attribute == "strength") {
-                        temprecord.attributes.strength = std::make_pair(minValue, maxValue);
-                    } else if (attribute == "dexterity") {
-                        temprecord.attributes.dexterity = std::make_pair(minValue, maxValue);
-                    } else if (attribute == "constitution") {
-                        temprecord.attributes.constitution = std::make_pair(minValue, maxValue);
-                    } else if (attribute == "agility") {
-                        temprecord.attributes.agility = std::make_pair(minValue, maxValue);
-                    } else if (attribute == "intelligence") {
-                        temprecord.attributes.intelligence = std::make_pair(minValue, maxValue);
-                    } else if (attribute == "perception") {
-                        temprecord.attributes.perception = std::make_pair(minValue, maxValue);
-                    } else if (attribute == "willpower") {
-                        temprecord.attributes.willpower = std::make_pair(minValue, maxValue);
-                    } else if (attribute == "essence") {
-                        temprecord.attributes.essence = std::make_pair(minValue, maxValue);
-                    } else {
-                        Logger::error(LogFacility::Other)
-                                << "Unknown attribute type for monster " << id << ": " << attribute << Log::end;
-                    }
+                table[id] = temprecord;
+                dataOK = true;
+            }
+
+            const auto findMonster = [this](uint32_t id) -> MonsterStruct * {
+                const auto it = table.find(id);
+                return it != table.end() ? &it->second : nullptr;
+            };
+
+            SelectQuery monAttrQuery(connection);
+            monAttrQuery.addColumn("monster_attributes", "mobattr_monsterid");
+            monAttrQuery.addColumn("monster_attributes", "mobattr_name");
+            monAttrQuery.addColumn("monster_attributes", "mobattr_min");
+            monAttrQuery.addColumn("monster_attributes", "mobattr_max");
+            monAttrQuery.addServerTable("monster_attributes");
+
+            for (const auto &attrRow : monAttrQuery.execute()) {
+                const auto id = attrRow["mobattr_monsterid"].as<uint32_t>();
+                auto *monster = findMonster(id);
+
+                if (monster == nullptr) {
+                    continue;
                 }
 
-                SelectQuery monSkillQuery(connection);
-                monSkillQuery.addColumn("monster_skills", "mobsk_skill_id");
-                monSkillQuery.addColumn("monster_skills", "mobsk_minvalue");
-                monSkillQuery.addColumn("monster_skills", "mobsk_maxvalue");
-                monSkillQuery.addEqualCondition("monster_skills", "mobsk_monsterid", id);
-                monSkillQuery.addServerTable("monster_skills");
+                auto &temprecord = *monster;
+                const auto attribute = attrRow["mobattr_name"].as<std::string>("");
+                auto minValue = attrRow["mobattr_min"].as<uint16_t>();
+                auto maxValue = attrRow["mobattr_max"].as<uint16_t>();
+
+                if (attribute == "luck") {
+                    temprecord.attributes.luck = std::make_pair(minValue, maxValue);
+                } else if (attribute == "strength") {
+                    temprecord.attributes.strength = std::make_pair(minValue, maxValue);
+                } else if (attribute == "dexterity") {
+                    temprecord.attributes.dexterity = std::make_pair(minValue, maxValue);
+                } else if (attribute == "constitution") {
+                    temprecord.attributes.constitution = std::make_pair(minValue, maxValue);
+                } else if (attribute == "agility") {
+                    temprecord.attributes.agility = std::make_pair(minValue, maxValue);
+                } else if (attribute == "intelligence") {
+                    temprecord.attributes.intelligence = std::make_pair(minValue, maxValue);
+                } else if (attribute == "perception") {
+                    temprecord.attributes.perception = std::make_pair(minValue, maxValue);
+                } else if (attribute == "willpower") {
+                    temprecord.attributes.willpower = std::make_pair(minValue, maxValue);
+                } else if (attribute == "essence") {
+                    temprecord.attributes.essence = std::make_pair(minValue, maxValue);
+                } else {
+                    Logger::error(LogFacility::Other)
+                            << "Unknown attribute type for monster " << id << ": " << attribute << Log::end;
+                }
+            }
 
-                Database::Result monSkillResults = monSkillQuery.execute();
+            SelectQuery monSkillQuery(connection);
+            monSkillQuery.addColumn("monster_skills", "mobsk_monsterid");
+            monSkillQuery.addColumn("monster_skills", "mobsk_skill_id");
+            monSkillQuery.addColumn("monster_skills", "mobsk_minvalue");
+            monSkillQuery.addColumn("monster_skills", "mobsk_maxvalue");
+            monSkillQuery.addServerTable("monster_skills");
 
-                for (const auto &skillRow : monSkillResults) {
-                    TYPE_OF_SKILL_ID skill = TYPE_OF_SKILL_ID(skillRow["mobsk_skill_id"].as<uint16_t>());
-                    auto minValue = skillRow["mobsk_minvalue"].as<uint16_t>();
-                    auto maxValue = skillRow["mobsk_maxvalue"].as<uint16_t>();
+            for (const auto &skillRow : monSkillQuery.execute()) {
+                auto *monster = findMonster(skillRow["mobsk_monsterid"].as<uint32_t>());
 
-                    temprecord.skills[skill] = std::make_pair(minValue, maxValue);
+                if (monster == nullptr) {
+                    continue;
                 }
 
-                SelectQuery monItemQuery(connection);
-                monItemQuery.addColumn("monster_items", "mobit_itemid");
-                monItemQuery.addColumn("monster_items", "mobit_position");
-                monItemQuery.addColumn("monster_items", "mobit_mincount");
-                monItemQuery.addColumn("monster_items", "mobit_maxcount");
-                monItemQuery.addEqualCondition("monster_items", "mobit_monsterid", id);
-                monItemQuery.addServerTable("monster_items");
-
-                Database::Result monItemResults = monItemQuery.execute();
-
-                for (const auto &itemRow : monItemResults) {
-                    itemdef_t tempitem;
-                    tempitem.itemid = itemRow["mobit_itemid"].as<TYPE_OF_ITEM_ID>();
-                    tempitem.amount = std::make_pair(itemRow["mobit_mincount"].as<uint16_t>(),
-                                                     itemRow["mobit_maxcount"].as<uint16_t>());
-
-                    const auto position = itemRow["mobit_position"].as<std::string>("");
-                    const auto location = [&]() -> std::optional<uint16_t> {
-                        if (position == "head") {
-                            return HEAD;
-                        }
-                        if (position == "neck") {
-                            return NECK;
-                        }
-                        if (position == "breast") {
-                            return BREAST;
-                        }
-                        if (position == "hands") {
-                            return HANDS;
-                        }
-                        if (position == "left hand") {
-                            return LEFT_TOOL;
-                        }
-                        if (position == "right hand") {
-                            return RIGHT_TOOL;
-                        }
-                        if (position == "left finger") {
-                            return FINGER_LEFT_HAND;
-                        }
-                        if (position == "right finger") {
-                            return FINGER_RIGHT_HAND;
-                        }
-                        if (position == "legs") {
-                            return LEGS;
-                        }
-                        if (position == "feet") {
-                            return FEET;
-                        }
-                        if (position == "coat") {
-                            return COAT;
-                        }
-                        if (position == "belt1") {
-                            return BELT1;
-                        }
-                        if (position == "belt2") {
-                            return BELT2;
-                        }
-                        if (position == "belt3") {
-                            return BELT3;
-                        }
-                        if (position == "belt4") {
-                            return BELT4;
-                        }
-                        if (position == "belt5") {
-                            return BELT5;
-                        }
-                        if (position == "belt6") {
-                            return BELT6;
-                        }
-                        Logger::error(LogFacility::Other)
-                                << "Invalid itemslot for monster " << id << ": " << position << Log::end;
-                        return std::nullopt;
-                    }();
-
-                    const auto &itemStruct = Data::items()[tempitem.itemid];
-
-                    if (location.has_value() && itemStruct.isValid()) {
-                        tempitem.AgeingSpeed = itemStruct.AgeingSpeed;
-                        temprecord.items[location.value()].push_back(tempitem);
-                    } else if (location.has_value()) {
-                        Logger::error(LogFacility::Other)
-                                << "Invalid item for monster " << id << ": " << tempitem.itemid << Log::end;
-                    }
+                TYPE_OF_SKILL_ID skill = TYPE_OF_SKILL_ID(skillRow["mobsk_skill_id"].as<uint16_t>());
+                auto minValue = skillRow["mobsk_minvalue"].as<uint16_t>();
+                auto maxValue = skillRow["mobsk_maxvalue"].as<uint16_t>();
+
+                monster->skills[skill] = std::make_pair(minValue, maxValue);
+            }
+
+            SelectQuery monItemQuery(connection);
+            monItemQuery.addColumn("monster_items", "mobit_monsterid");
+            monItemQuery.addColumn("monster_items", "mobit_itemid");
+            monItemQuery.addColumn("monster_items", "mobit_position");
+            monItemQuery.addColumn("monster_items", "mobit_mincount");
+            monItemQuery.addColumn("monster_items", "mobit_maxcount");
+            monItemQuery.addServerTable("monster_items");
+
+            for (const auto &itemRow : monItemQuery.execute()) {
+                const auto id = itemRow["mobit_monsterid"].as<uint32_t>();
+                auto *monster = findMonster(id);
+
+                if (monster == nullptr) {
+                    continue;
                 }
 
-                SelectQuery monLootQuery(connection);
-                monLootQuery.addColumn("monster_drop", "md_id");
-                monLootQuery.addColumn("monster_drop", "md_category");
-                monLootQuery.addColumn("monster_drop", "md_probability");
-                monLootQuery.addColumn("monster_drop", "md_itemid");
-                monLootQuery.addColumn("monster_drop", "md_amount_min");
-                monLootQuery.addColumn("monster_drop", "md_amount_max");
-                monLootQuery.addColumn("monster_drop", "md_quality_min");
-                monLootQuery.addColumn("monster_drop", "md_quality_max");
-                monLootQuery.addColumn("monster_drop", "md_durability_min");
-                monLootQuery.addColumn("monster_drop", "md_durability_max");
-                monLootQuery.addEqualCondition("monster_drop", "md_monsterid", id);
-                monLootQuery.addServerTable("monster_drop");
-
-                const auto monLootResults = monLootQuery.execute();
-
-                for (const auto &lootRow : monLootResults) {
-                    auto lootId = lootRow["md_id"].as<uint32_t>();
-                    auto categoryId = lootRow["md_category"].as<uint16_t>();
-
-                    auto &category = temprecord.loot[categoryId];
-                    auto &lootItem = category[lootId];
-
-                    lootItem.itemId = lootRow["md_itemid"].as<TYPE_OF_ITEM_ID>();
-                    lootItem.probability = lootRow["md_probability"].as<double>();
-                    lootItem.amount = std::make_pair(lootRow["md_amount_min"].as<uint16_t>(),
-                                                     lootRow["md_amount_max"].as<uint16_t>());
-                    lootItem.quality = std::make_pair(lootRow["md_quality_min"].as<uint16_t>(),
-                                                      lootRow["md_quality_max"].as<uint16_t>());
-                    lootItem.durability = std::make_pair(lootRow["md_durability_min"].as<uint16_t>(),
-                                                         lootRow["md_durability_max"].as<uint16_t>());
-                    lootItem.data = std::move(lootData[lootId]);
+                itemdef_t tempitem;
+                tempitem.itemid = itemRow["mobit_itemid"].as<TYPE_OF_ITEM_ID>();
+                tempitem.amount = std::make_pair(itemRow["mobit_mincount"].as<uint16_t>(),
+                                                 itemRow["mobit_maxcount"].as<uint16_t>());
+
+                const auto position = itemRow["mobit_position"].as<std::string>("");
+                const auto location = itemSlotFromName(position);
+
+                if (!location.has_value()) {
+                    Logger::error(LogFacility::Other)
+                            << "Invalid itemslot for monster " << id << ": " << position << Log::end;
+                    continue;
                 }
 
-                table[id] = temprecord;
-                dataOK = true;
+                const auto &itemStruct = Data::items()[tempitem.itemid];
+
+                if (itemStruct.isValid()) {
+                    tempitem.AgeingSpeed = itemStruct.AgeingSpeed;
+                    monster->items[location.value()].push_back(tempitem);
+                } else {
+                    Logger::error(LogFacility::Other)
+                            << "Invalid item for monster " << id << ": " << tempitem.itemid << Log::end;
+                }
+            }
+
+            SelectQuery monLootQuery(connection);
+            monLootQuery.addColumn("monster_drop", "md_monsterid");
+            monLootQuery.addColumn("monster_drop", "md_id");
+            monLootQuery.addColumn("monster_drop", "md_category");
+            monLootQuery.addColumn("monster_drop", "md_probability");
+            monLootQuery.addColumn("monster_drop", "md_itemid");
+            monLootQuery.addColumn("monster_drop", "md_amount_min");
+            monLootQuery.addColumn("monster_drop", "md_amount_max");
+            monLootQuery.addColumn("monster_drop", "md_quality_min");
+            monLootQuery.addColumn("monster_drop", "md_quality_max");
+            monLootQuery.addColumn("monster_drop", "md_durability_min");
+            monLootQuery.addColumn("monster_drop", "md_durability_max");
+            monLootQuery.addServerTable("monster_drop");
+
+            for (const auto &lootRow : monLootQuery.execute()) {
+                auto *monster = findMonster(lootRow["md_monsterid"].as<uint32_t>());
+
+                if (monster == nullptr) {
+                    continue;
+                }
+
+                auto lootId = lootRow["md_id"].as<uint32_t>();
+                auto categoryId = lootRow["md_category"].as<uint16_t>();
+
+                auto &category = monster->loot[categoryId];
+                auto &lootItem = category[lootId];
+
+                lootItem.itemId = lootRow["md_itemid"].as<TYPE_OF_ITEM_ID>();
+                lootItem.probability = lootRow["md_probability"].as<double>();
+                lootItem.amount = std::make_pair(lootRow["md_amount_min"].as<uint16_t>(),
+                                                 lootRow["md_amount_max"].as<uint16_t>());
+                lootItem.quality = std::make_pair(lootRow["md_quality_min"].as<uint16_t>(),
+                                                  lootRow["md_quality_max"].as<uint16_t>());
+                lootItem.durability = std::make_pair(lootRow["md_durability_min"].as<uint16_t>(),
+                                                     lootRow["md_durability_max"].as<uint16_t>());
+                lootItem.data = std::move(lootData[lootId]);
             }
         }
 
         connection->commitTransaction();
-        Logger::info(LogFacility::Other) << "Loaded " << table.size() << " monsters!" << Log::end;
+
+        const auto loadTime = duration_cast<milliseconds>(steady_clock::now() - startTime).count();
+        Logger::info(LogFacility::Other) << "Loaded " << table.size() << " monsters in " << loadTime << " ms!"
+                                         << Log::end;
     } catch (std::exception &e) {
         Logger::error(LogFacility::Other) << "Exception in MonsterTable::reload: " << e.what() << Log::end;
         dataOK = false;
@@ -24,22 +24,28 @@
 #include "Random.hpp"
 #include "db/Result.hpp"
 #include "db/SelectQuery.hpp"
+#include "tuningConstants.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 
 ScheduledScriptsTable::ScheduledScriptsTable() { reload(); }
 
 void ScheduledScriptsTable::nextCycle() {
+    using std::chrono::steady_clock;
     currentCycle++;
-    ScriptData data; /**< holds the current task*/
-    constexpr auto scriptLimit = 200;
-    int emexit = 0; /**< emergency counter which breaks the loop if too much execution*/
+    const auto startTime = steady_clock::now();
 
-    while (!m_table.empty() && (emexit++ < scriptLimit) && (m_table.front().nextCycleTime <= currentCycle)) {
-        data = m_table.front(); /**< copy the first data in data*/
-        m_table.pop_front();    /**< deletes the first task */
+    // run at least one script per cycle, due scripts left over when the time budget is spent are run next cycle
+    while (!m_table.empty() && (m_table.front().nextCycleTime <= currentCycle)) {
+        std::pop_heap(m_table.begin(), m_table.end(), runsLater);
+        ScriptData data = std::move(m_table.back()); /**< holds the current task*/
+        m_table.pop_back();
 
         if (data.scriptptr) {
+            recordLateness(data);
+
             /**calculate the next time when the script is invoked */
             data.nextCycleTime += Random::uniform(data.minCycleTime, data.maxCycleTime);
 
@@ -48,27 +54,47 @@ void ScheduledScriptsTable::nextCycle() {
 
             data.lastCycleTime = currentCycle; /**< script was run so we can change lastCycleTime*/
 
-            addData(data); /**< insert the script in the list again*/
+            addData(data); /**< insert the script in the queue again*/
+        }
+
+        if (steady_clock::now() - startTime >= scheduledScriptsTimeBudget) {
+            break;
         }
     }
 }
 
-void ScheduledScriptsTable::addData(const ScriptData &data) {
-    Logger::debug(LogFacility::Script) << "insert new Task task.nextCycle: " << data.nextCycleTime
-                                       << " current Cycle: " << currentCycle << Log::end;
-    bool inserted = false;
+void ScheduledScriptsTable::recordLateness(ScriptData &data) const {
+    if (data.nextCycleTime >= currentCycle) {
+        return;
+    }
 
-    for (auto it = m_table.begin(); it != m_table.end(); ++it) {
-        if (it->nextCycleTime > data.nextCycleTime) {
-            m_table.insert(it, data);
-            inserted = true;
-            break;
-        }
+    const uint32_t lateness = currentCycle - data.nextCycleTime;
+    ++data.lateRuns;
+    data.totalLateness += lateness;
+
+    if (lateness > data.maxLateness) {
+        data.maxLateness = lateness;
+        Logger::warn(LogFacility::Script) << "Scheduled script " << data.scriptName << "." << data.functionName
+                                          << " started " << lateness << " cycles late, average lateness "
+                                          << data.totalLateness / data.lateRuns << " cycles over " << data.lateRuns
+                                          << " late runs" << Log::end;
     }
+}
 
-    if (!inserted) {
-        m_table.push_back(data);
+auto ScheduledScriptsTable::runsLater(const ScriptData &lhs, const ScriptData &rhs) -> bool {
+    if (lhs.nextCycleTime != rhs.nextCycleTime) {
+        return lhs.nextCycleTime > rhs.nextCycleTime;
     }
+
+    return lhs.sequence > rhs.sequence;
+}
+
+void ScheduledScriptsTable::addData(const ScriptData &data) {
+    Logger::debug(LogFacility::Script) << "insert new Task task.nextCycle: " << data.nextCycleTime
+                                       << " current Cycle: " << currentCycle << Log::end;
+    m_table.push_back(data);
+    m_table.back().sequence = nextSequence++;
+    std::push_heap(m_table.begin(), m_table.end(), runsLater);
 }
 
 void ScheduledScriptsTable::reload() {
@@ -89,7 +115,8 @@ void ScheduledScriptsTable::reload() {
             for (const auto &row : results) {
                 tmpRecord.minCycleTime = row["sc_mincycletime"].as<uint32_t>();
                 tmpRecord.maxCycleTime = row["sc_maxcycletime"].as<uint32_t>();
-                tmpRecord.nextCycleTime = 0;
+                // due in the first cycle of the new table, which does not count as late
+                tmpRecord.nextCycleTime = currentCycle + 1;
 
                 if (!row["sc_scriptname"].is_null() && !row["sc_functionname"].is_null()) {
                     tmpRecord.functionName = row["sc_functionname"].as<std::string>();
@@ -24,11 +24,11 @@
 #include "script/LuaScheduledScript.hpp"
 
 #include <boost/unordered_map.hpp>
-#include <list>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 class World;
 
@@ -41,6 +41,14 @@ struct ScriptData {
     std::string scriptName;
     std::shared_ptr<LuaScheduledScript> scriptptr;
 
+    // keeps scripts due in the same cycle in insertion order
+    uint64_t sequence = 0;
+
+    // cycles the script was started after it was due
+    uint32_t lateRuns = 0;
+    uint32_t maxLateness = 0;
+    uint64_t totalLateness = 0;
+
     ScriptData() = default;
     ScriptData(uint32_t minCT, uint32_t maxCT, uint32_t nextCT, uint32_t lastCT, std::string fname, std::string sname)
             : minCycleTime(minCT), maxCycleTime(maxCT), nextCycleTime(nextCT), lastCycleTime(lastCT),
@@ -60,10 +68,15 @@ public:
 private:
     void reload();
 
-    std::list<ScriptData> m_table;
+    // binary min-heap ordered by nextCycleTime
+    std::vector<ScriptData> m_table;
     uint32_t currentCycle{0};
+    uint64_t nextSequence{0};
     bool m_dataOk{false};
 
     void clearOldTable();
+    void recordLateness(ScriptData &data) const;
+
+    static auto runsLater(const ScriptData &lhs, const ScriptData &rhs) -> bool;
 };
 #endif
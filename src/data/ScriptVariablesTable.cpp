@@ -20,12 +20,13 @@
 
 #include "data/ScriptVariablesTable.hpp"
 
+#include "PersistenceQueue.hpp"
 #include "db/Connection.hpp"
-#include "db/ConnectionManager.hpp"
 #include "db/DeleteQuery.hpp"
 #include "db/InsertQuery.hpp"
 
 #include <iostream>
+#include <utility>
 
 auto ScriptVariablesTable::getTableName() const -> std::string { return "scriptvariables"; }
 
@@ -49,7 +50,10 @@ auto ScriptVariablesTable::find(const std::string &id, std::string &ret) -> bool
     return false;
 }
 
-void ScriptVariablesTable::set(const std::string &id, const std::string &value) { get(id) = value; }
+void ScriptVariablesTable::set(const std::string &id, const std::string &value) {
+    get(id) = value;
+    changedIds.insert(id);
+}
 
 void ScriptVariablesTable::set(const std::string &id, int32_t value) {
     std::stringstream ss;
@@ -57,36 +61,85 @@ void ScriptVariablesTable::set(const std::string &id, int32_t value) {
     set(id, ss.str());
 }
 
-auto ScriptVariablesTable::remove(const std::string &id) -> bool { return erase(id); }
+auto ScriptVariablesTable::remove(const std::string &id) -> bool {
+    if (erase(id)) {
+        changedIds.insert(id);
+        return true;
+    }
+
+    return false;
+}
 
 void ScriptVariablesTable::save() {
-    try {
-        using namespace Database;
-        PConnection connection = ConnectionManager::getInstance().getConnection();
-        connection->beginTransaction();
-
-        DeleteQuery delQuery(connection);
-        delQuery.setServerTable("scriptvariables");
-        delQuery.execute();
-
-        InsertQuery insQuery(connection);
-        insQuery.setServerTable("scriptvariables");
-        const InsertQuery::columnIndex idColumn = insQuery.addColumn("svt_ids");
-        const InsertQuery::columnIndex valueColumn = insQuery.addColumn("svt_string");
-
-        for (const auto &var : *this) {
-            if (var.second.length() > 0) {
-                insQuery.addValue<std::string>(idColumn, var.first);
-                insQuery.addValue<std::string>(valueColumn, var.second);
+    const bool rewrite = saveFailed.exchange(false);
+
+    if (changedIds.empty() && !rewrite) {
+        return;
+    }
+
+    std::vector<std::pair<std::string, std::string>> updated;
+    std::vector<std::string> removed;
+
+    if (rewrite) {
+        for (const auto &[id, value] : *this) {
+            if (!value.empty()) {
+                updated.emplace_back(id, value);
             }
         }
+    } else {
+        for (const auto &id : changedIds) {
+            // empty values have never been stored
+            if (std::string value; find(id, value) && !value.empty()) {
+                updated.emplace_back(id, std::move(value));
+            } else {
+                removed.push_back(id);
+            }
+        }
+    }
 
-        insQuery.execute();
+    changedIds.clear();
 
-        connection->commitTransaction();
-    } catch (std::exception &e) {
-        Logger::error(LogFacility::Other) << "Exception in ScriptVariablesTable::save: " << e.what() << Log::end;
-    }
+    auto job = [this, rewrite, updated = std::move(updated),
+                removed = std::move(removed)](const Database::PConnection &connection) {
+        using namespace Database;
+
+        try {
+            connection->beginTransaction();
+
+            if (rewrite || !removed.empty()) {
+                DeleteQuery delQuery(connection);
+
+                if (!rewrite) {
+                    delQuery.addInCondition<std::string>("scriptvariables", "svt_ids", removed);
+                }
+
+                delQuery.setServerTable("scriptvariables");
+                delQuery.execute();
+            }
+
+            if (!updated.empty()) {
+                InsertQuery insQuery(connection);
+                insQuery.setServerTable("scriptvariables");
+                const InsertQuery::columnIndex idColumn = insQuery.addColumn("svt_ids");
+                const InsertQuery::columnIndex valueColumn = insQuery.addColumn("svt_string");
+                insQuery.onConflictUpdate({"svt_ids"}, {"svt_string"});
+
+                for (const auto &[id, value] : updated) {
+                    insQuery.addValue<std::string>(idColumn, id);
+                    insQuery.addValue<std::string>(valueColumn, value);
+                }
+
+                insQuery.execute();
+            }
+
+            connection->commitTransaction();
+        } catch (...) {
+            saveFailed = true;
+            throw;
+        }
+    };
+
+    PersistenceQueue::get().push("script variables", std::move(job));
 }
 
 auto ScriptVariablesTable::reloadBuffer() -> bool {
@@ -23,6 +23,9 @@
 
 #include "data/StructTable.hpp"
 
+#include <atomic>
+#include <unordered_set>
+
 class ScriptVariablesTable : public StructTable<std::string, std::string> {
 public:
     auto getTableName() const -> std::string override;
@@ -35,6 +38,10 @@ public:
     void set(const std::string &id, int32_t value);
     auto remove(const std::string &id) -> bool;
 
+    /**
+     * Queues the variables changed since the last save for writing, without blocking on the database.
+     * After a failed write all variables are written again.
+     */
     void save();
 
     auto reloadBuffer() -> bool override;
@@ -43,6 +50,9 @@ public:
 private:
     using Base = StructTable<std::string, std::string>;
     bool first = true;
+    std::unordered_set<std::string> changedIds;
+    // set by the persistence thread, the changes of a failed write are lost otherwise
+    std::atomic_bool saveFailed = false;
 };
 
 #endif
@@ -20,6 +20,10 @@
 
 #include "data/TriggerTable.hpp"
 
+#include "World.hpp"
+
+#include <range/v3/all.hpp>
+
 auto TriggerTable::getTableName() const -> std::string { return "triggerfields"; }
 
 auto TriggerTable::getColumnNames() -> std::vector<std::string> {
@@ -41,3 +45,27 @@ auto TriggerTable::assignScriptName(const Database::ResultTuple &row) -> std::st
 }
 
 auto TriggerTable::getQuestScripts() -> NodeRange { return QuestNodeTable::getInstance().getTriggerNodes(); }
+
+void TriggerTable::activateBuffer() {
+    setFieldFlags(false);
+    QuestScriptStructTable::activateBuffer();
+    setFieldFlags(true);
+}
+
+void TriggerTable::setFieldFlags(bool hasTrigger) {
+    auto *world = World::get();
+
+    for (const auto &pos : *this | ranges::views::keys) {
+        try {
+            auto &field = world->fieldAt(pos);
+
+            if (hasTrigger) {
+                field.setTrigger();
+            } else {
+                field.removeTrigger();
+            }
+        } catch (FieldNotFound &) {
+            // fields of maps loaded later are flagged when their map is inserted
+        }
+    }
+}
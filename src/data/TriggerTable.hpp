@@ -38,6 +38,15 @@ public:
     auto assignTable(const Database::ResultTuple &row) -> TriggerStruct override;
     auto assignScriptName(const Database::ResultTuple &row) -> std::string override;
     auto getQuestScripts() -> NodeRange override;
+
+    /**
+     * Activates the loaded triggers and moves the trigger flags of the map fields along,
+     * so moving characters only need to look up triggers on flagged fields.
+     */
+    void activateBuffer() override;
+
+private:
+    void setFieldFlags(bool hasTrigger);
 };
 
 #endif
@@ -36,6 +36,24 @@ InsertQuery::InsertQuery(const PConnection &connection) : Query(connection) {
     setHideTable(true);
 }
 
+void InsertQuery::onConflictUpdate(std::initializer_list<std::string> keyColumns,
+                                   std::initializer_list<std::string> updateColumns) {
+    std::string keys;
+    std::string assignments;
+
+    for (const auto &column : keyColumns) {
+        appendToStringList(keys, escapeKey(column));
+    }
+
+    for (const auto &column : updateColumns) {
+        appendToStringList(assignments, escapeKey(column) + " = EXCLUDED." + escapeKey(column));
+    }
+
+    conflictClause = " ON CONFLICT (" + keys + ") DO UPDATE SET " + assignments;
+}
+
+void InsertQuery::onConflictIgnore() { conflictClause = " ON CONFLICT DO NOTHING"; }
+
 auto InsertQuery::execute() -> Result {
     if (dataStorage.empty()) {
         Result result;
@@ -74,7 +92,9 @@ auto InsertQuery::execute() -> Result {
 
     dataStorage.clear();
 
-    ss << ");";
+    ss << ")";
+    ss << conflictClause;
+    ss << ";";
 
     setQuery(ss.str());
     return Query::execute();
@@ -28,6 +28,7 @@
 #include "db/Result.hpp"
 
 #include <boost/cstdint.hpp>
+#include <initializer_list>
 #include <map>
 #include <optional>
 #include <stdexcept>
@@ -38,6 +39,7 @@ namespace Database {
 class InsertQuery : Query, public QueryColumns, public QueryTables {
 private:
     std::vector<std::vector<std::optional<std::string>>> dataStorage;
+    std::string conflictClause;
 
 public:
     enum MapInsertMode { onlyKeys, onlyValues, keysAndValues };
@@ -135,6 +137,12 @@ public:
         }
     }
 
+    // turns the insert into an upsert, updating the given columns of rows that already exist with the same key
+    void onConflictUpdate(std::initializer_list<std::string> keyColumns,
+                          std::initializer_list<std::string> updateColumns);
+    // skips rows that would violate a unique constraint instead of failing
+    void onConflictIgnore();
+
     auto execute() -> Result override;
 };
 } // namespace Database
@@ -27,6 +27,7 @@
 #include <boost/cstdint.hpp>
 #include <stack>
 #include <string>
+#include <vector>
 
 namespace Database {
 class QueryWhere {
@@ -61,6 +62,17 @@ public:
                 std::string(Query::escapeAndChainKeys(table, column) + " != " + connection.quote<T>(value)));
     }
 
+    template <typename T>
+    void addInCondition(const std::string &table, const std::string &column, const std::vector<T> &values) {
+        std::string list;
+
+        for (const auto &value : values) {
+            Query::appendToStringList(list, connection.quote<T>(value));
+        }
+
+        conditionsStack.push(std::string(Query::escapeAndChainKeys(table, column) + " IN (" + list + ")"));
+    }
+
     void andConditions();
     void orConditions();
 
@@ -22,6 +22,7 @@
 #include "InitialConnection.hpp"
 #include "Logger.hpp"
 #include "MonitoringClients.hpp"
+#include "PersistenceQueue.hpp"
 #include "Player.hpp"
 #include "PlayerManager.hpp"
 #include "World.hpp"
@@ -70,6 +71,7 @@ auto main(int argc, char *argv[]) -> int {
     // initialise DB Manager
     Database::ConnectionManager::getInstance().setupManager();
     Database::SchemaHelper::setSchemata();
+    PersistenceQueue::get().activate();
 
     std::unique_ptr<World> world(World::create());
 
@@ -155,6 +157,7 @@ auto main(int argc, char *argv[]) -> int {
 
     world->forceLogoutOfAllPlayers();
     PlayerManager::get().stop();
+    PersistenceQueue::get().stop();
     world->takeMonsterAndNPCFromMap();
 
     world->Save();
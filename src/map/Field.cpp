@@ -37,12 +37,7 @@
 namespace map {
 
 Field::Field(uint16_t tile, uint16_t music, const position &here, bool persistent)
-        : tile(tile), music(music), here(here), persistent(persistent) {
-    if (persistent) {
-        loadDatabaseWarp();
-        loadDatabaseItems();
-    }
-}
+        : tile(tile), music(music), here(here), persistent(persistent) {}
 
 void Field::setTileId(uint16_t id) {
     tile = id;
@@ -341,7 +336,7 @@ void Field::load(std::ifstream &mapStream, std::ifstream &itemStream, std::ifstr
     readFromStream(mapStream, music);
     readFromStream(mapStream, flags);
 
-    unsetBits(FLAG_NPCONFIELD | FLAG_MONSTERONFIELD | FLAG_PLAYERONFIELD);
+    unsetBits(FLAG_NPCONFIELD | FLAG_MONSTERONFIELD | FLAG_PLAYERONFIELD | FLAG_TRIGGERFIELD);
 
     MAXCOUNTTYPE size = 0;
     readFromStream(itemStream, size);
@@ -408,6 +403,16 @@ void Field::removePersistence() {
 
 auto Field::isPersistent() const -> bool { return persistent; }
 
+void Field::restoreWarp(const position &target) {
+    warptarget = target;
+    setBits(FLAG_WARPFIELD);
+}
+
+void Field::restoreItems(std::vector<Item> &&stack) {
+    items = std::move(stack);
+    updateFlags();
+}
+
 void Field::age() {
     for (const auto &container : containers) {
         if (container.second != nullptr) {
@@ -524,6 +529,12 @@ void Field::removeWarp() {
 
 void Field::getWarp(position &pos) const { pos = warptarget; }
 
+void Field::setTrigger() { setBits(FLAG_TRIGGERFIELD); }
+
+void Field::removeTrigger() { unsetBits(FLAG_TRIGGERFIELD); }
+
+auto Field::hasTrigger() const -> bool { return anyBitSet(FLAG_TRIGGERFIELD); }
+
 auto Field::hasSpecialItem() const -> bool { return anyBitSet(FLAG_SPECIALITEM); }
 
 auto Field::isWalkable() const -> bool { return !anyBitSet(FLAG_BLOCKPATH) || anyBitSet(FLAG_MAKEPASSABLE); }
@@ -754,86 +765,6 @@ void Field::updateDatabaseWarp() const noexcept {
     }
 }
 
-void Field::loadDatabaseWarp() noexcept {
-    try {
-        using namespace Database;
-
-        SelectQuery query;
-        query.addColumn("map_warps", "mw_target_x");
-        query.addColumn("map_warps", "mw_target_y");
-        query.addColumn("map_warps", "mw_target_z");
-        query.addEqualCondition<int16_t>("map_warps", "mw_start_x", here.x);
-        query.addEqualCondition<int16_t>("map_warps", "mw_start_y", here.y);
-        query.addEqualCondition<int16_t>("map_warps", "mw_start_z", here.z);
-        query.addServerTable("map_warps");
-
-        auto result = query.execute();
-
-        if (not result.empty()) {
-            const auto &row = result.front();
-            warptarget.x = row["mw_target_x"].as<int16_t>();
-            warptarget.y = row["mw_target_y"].as<int16_t>();
-            warptarget.z = row["mw_target_z"].as<int16_t>();
-            setBits(FLAG_WARPFIELD);
-        }
-    } catch (std::exception &e) {
-        Logger::error(LogFacility::World) << "Error while loading warp from database: " << e.what() << Log::end;
-    }
-}
-
-void Field::loadDatabaseItems() noexcept {
-    try {
-        using namespace Database;
-
-        SelectQuery query;
-        query.addColumn("map_items", "mi_stack_pos");
-        query.addColumn("map_items", "mi_item");
-        query.addColumn("map_items", "mi_quality");
-        query.addColumn("map_items", "mi_number");
-        query.addColumn("map_items", "mi_wear");
-        query.addEqualCondition<int16_t>("map_items", "mi_x", here.x);
-        query.addEqualCondition<int16_t>("map_items", "mi_y", here.y);
-        query.addEqualCondition<int16_t>("map_items", "mi_z", here.z);
-        query.addOrderBy("map_items", "mi_stack_pos", SelectQuery::ASC);
-        query.addServerTable("map_items");
-
-        SelectQuery dataQuery;
-        dataQuery.addColumn("map_item_data", "mid_stack_pos");
-        dataQuery.addColumn("map_item_data", "mid_key");
-        dataQuery.addColumn("map_item_data", "mid_value");
-        dataQuery.addEqualCondition<int16_t>("map_item_data", "mid_x", here.x);
-        dataQuery.addEqualCondition<int16_t>("map_item_data", "mid_y", here.y);
-        dataQuery.addEqualCondition<int16_t>("map_item_data", "mid_z", here.z);
-        dataQuery.addOrderBy("map_item_data", "mid_stack_pos", SelectQuery::ASC);
-        dataQuery.addServerTable("map_item_data");
-
-        auto result = query.execute();
-        auto dataResult = dataQuery.execute();
-        auto dataIterator = dataResult.cbegin();
-        auto dataEnd = dataResult.cend();
-
-        for (const auto &row : result) {
-            auto stackPos = row["mi_stack_pos"].as<uint16_t>();
-            auto item = row["mi_item"].as<TYPE_OF_ITEM_ID>();
-            auto quality = row["mi_quality"].as<uint16_t>();
-            auto number = row["mi_number"].as<uint16_t>();
-            auto wear = row["mi_wear"].as<uint16_t>();
-
-            items.emplace_back(item, number, wear, quality);
-
-            while (dataIterator < dataEnd && (*dataIterator)["mid_stack_pos"].as<uint16_t>() == stackPos) {
-                items.back().setData((*dataIterator)["mid_key"].as<std::string>(),
-                                     (*dataIterator)["mid_value"].as<std::string>());
-                ++dataIterator;
-            }
-        }
-
-        updateFlags();
-    } catch (std::exception &e) {
-        Logger::error(LogFacility::World) << "Error while loading items from database: " << e.what() << Log::end;
-    }
-}
-
 void updateFieldToPlayersInScreen(const position &pos) {
     auto playersInScreen = World::get()->Players.findAllCharactersInScreen(pos);
 
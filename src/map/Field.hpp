@@ -103,6 +103,10 @@ public:
     void getWarp(position &pos) const;
     [[nodiscard]] auto isWarp() const -> bool;
 
+    void setTrigger();
+    void removeTrigger();
+    [[nodiscard]] auto hasTrigger() const -> bool;
+
     [[nodiscard]] auto getExportItems() const -> std::vector<Item>;
     void save(std::ofstream &mapStream, std::ofstream &itemStream, std::ofstream &warpStream,
               std::ofstream &containerStream) const;
@@ -115,6 +119,10 @@ public:
     void removePersistence();
     [[nodiscard]] auto isPersistent() const -> bool;
 
+    // restore persistent state read from the database without writing it back
+    void restoreWarp(const position &target);
+    void restoreItems(std::vector<Item> &&stack);
+
 private:
     void updateFlags();
     inline void setBits(uint8_t /*bits*/);
@@ -126,8 +134,6 @@ private:
     void updateDatabaseField() const noexcept;
     void updateDatabaseItems() const noexcept;
     void updateDatabaseWarp() const noexcept;
-    void loadDatabaseWarp() noexcept;
-    void loadDatabaseItems() noexcept;
 };
 
 void updateFieldToPlayersInScreen(const position &pos);
@@ -25,6 +25,9 @@
 #include "NPC.hpp"
 #include "Player.hpp"
 #include "World.hpp"
+#include "data/Data.hpp"
+#include "db/Connection.hpp"
+#include "db/ConnectionManager.hpp"
 #include "db/Result.hpp"
 #include "db/SelectQuery.hpp"
 #include "stream.hpp"
@@ -34,6 +37,7 @@
 #include <chrono>
 #include <filesystem>
 #include <iomanip>
+#include <map>
 #include <range/v3/all.hpp>
 #include <regex>
 #include <sstream>
@@ -77,6 +81,14 @@ auto WorldMap::insert(Map &&newMap) -> bool {
         }
     }
 
+    using namespace ranges;
+    auto isOnMap = [&map, z](const auto &pos) {
+        return pos.z == z && pos.x >= map.getMinX() && pos.x <= map.getMaxX() && pos.y >= map.getMinY() &&
+               pos.y <= map.getMaxY();
+    };
+    for_each(Data::triggers() | views::keys | views::filter(isOnMap),
+             [&map](const auto &pos) { map.at(pos.x, pos.y).setTrigger(); });
+
     return true;
 }
 
@@ -402,30 +414,139 @@ auto WorldMap::loadFromDisk() -> bool {
 void WorldMap::loadPersistentFields() {
     persistentFields.clear();
 
-    using namespace Database;
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+    using std::chrono::steady_clock;
+    const auto startTime = steady_clock::now();
+
+    try {
+        using namespace Database;
+        PConnection connection = ConnectionManager::getInstance().getConnection();
+        connection->beginTransaction();
+
+        SelectQuery query(connection);
+        query.addColumn("map_tiles", "mt_x");
+        query.addColumn("map_tiles", "mt_y");
+        query.addColumn("map_tiles", "mt_z");
+        query.addColumn("map_tiles", "mt_tile");
+        query.addColumn("map_tiles", "mt_music");
+        query.addServerTable("map_tiles");
+
+        auto result = query.execute();
+        Logger::info(LogFacility::World) << "Loading " << result.size() << " persistent fields." << Log::end;
+
+        const bool isPersistent = true;
+
+        for (const auto &row : result) {
+            position pos(row["mt_x"].as<int16_t>(), row["mt_y"].as<int16_t>(), row["mt_z"].as<int16_t>());
+
+            auto tile = row["mt_tile"].as<uint16_t>();
+            auto music = row["mt_music"].as<uint16_t>();
+            Field field(tile, music, pos, isPersistent);
+
+            if (Data::triggers().exists(pos)) {
+                field.setTrigger();
+            }
+
+            persistentFields.emplace(pos, std::move(field));
+        }
+
+        SelectQuery warpQuery(connection);
+        warpQuery.addColumn("map_warps", "mw_start_x");
+        warpQuery.addColumn("map_warps", "mw_start_y");
+        warpQuery.addColumn("map_warps", "mw_start_z");
+        warpQuery.addColumn("map_warps", "mw_target_x");
+        warpQuery.addColumn("map_warps", "mw_target_y");
+        warpQuery.addColumn("map_warps", "mw_target_z");
+        warpQuery.addServerTable("map_warps");
+
+        for (const auto &row : warpQuery.execute()) {
+            position pos(row["mw_start_x"].as<int16_t>(), row["mw_start_y"].as<int16_t>(),
+                         row["mw_start_z"].as<int16_t>());
+            const auto field = persistentFields.find(pos);
+
+            if (field != persistentFields.end()) {
+                position target(row["mw_target_x"].as<int16_t>(), row["mw_target_y"].as<int16_t>(),
+                                row["mw_target_z"].as<int16_t>());
+                field->second.restoreWarp(target);
+            }
+        }
+
+        SelectQuery itemQuery(connection);
+        itemQuery.addColumn("map_items", "mi_x");
+        itemQuery.addColumn("map_items", "mi_y");
+        itemQuery.addColumn("map_items", "mi_z");
+        itemQuery.addColumn("map_items", "mi_stack_pos");
+        itemQuery.addColumn("map_items", "mi_item");
+        itemQuery.addColumn("map_items", "mi_quality");
+        itemQuery.addColumn("map_items", "mi_number");
+        itemQuery.addColumn("map_items", "mi_wear");
+        itemQuery.addServerTable("map_items");
 
-    SelectQuery query;
-    query.addColumn("map_tiles", "mt_x");
-    query.addColumn("map_tiles", "mt_y");
-    query.addColumn("map_tiles", "mt_z");
-    query.addColumn("map_tiles", "mt_tile");
-    query.addColumn("map_tiles", "mt_music");
-    query.addServerTable("map_tiles");
+        std::unordered_map<position, std::map<uint16_t, Item>> stacks;
 
-    auto result = query.execute();
-    Logger::info(LogFacility::World) << "Loading " << result.size() << " persistent fields." << Log::end;
+        for (const auto &row : itemQuery.execute()) {
+            position pos(row["mi_x"].as<int16_t>(), row["mi_y"].as<int16_t>(), row["mi_z"].as<int16_t>());
 
-    const bool isPersistent = true;
+            if (persistentFields.count(pos) == 0) {
+                continue;
+            }
+
+            auto stackPos = row["mi_stack_pos"].as<uint16_t>();
+            auto item = row["mi_item"].as<TYPE_OF_ITEM_ID>();
+            auto quality = row["mi_quality"].as<uint16_t>();
+            auto number = row["mi_number"].as<uint16_t>();
+            auto wear = row["mi_wear"].as<uint16_t>();
+
+            stacks[pos].emplace(stackPos, Item(item, number, wear, quality));
+        }
+
+        SelectQuery dataQuery(connection);
+        dataQuery.addColumn("map_item_data", "mid_x");
+        dataQuery.addColumn("map_item_data", "mid_y");
+        dataQuery.addColumn("map_item_data", "mid_z");
+        dataQuery.addColumn("map_item_data", "mid_stack_pos");
+        dataQuery.addColumn("map_item_data", "mid_key");
+        dataQuery.addColumn("map_item_data", "mid_value");
+        dataQuery.addServerTable("map_item_data");
+
+        for (const auto &row : dataQuery.execute()) {
+            position pos(row["mid_x"].as<int16_t>(), row["mid_y"].as<int16_t>(), row["mid_z"].as<int16_t>());
+            const auto stack = stacks.find(pos);
+
+            if (stack == stacks.end()) {
+                continue;
+            }
+
+            const auto item = stack->second.find(row["mid_stack_pos"].as<uint16_t>());
+
+            if (item != stack->second.end()) {
+                item->second.setData(row["mid_key"].as<std::string>(), row["mid_value"].as<std::string>());
+            }
+        }
 
-    for (const auto &row : result) {
-        position pos(row["mt_x"].as<int16_t>(), row["mt_y"].as<int16_t>(), row["mt_z"].as<int16_t>());
+        connection->commitTransaction();
 
-        auto tile = row["mt_tile"].as<uint16_t>();
-        auto music = row["mt_music"].as<uint16_t>();
-        Field field(tile, music, pos, isPersistent);
+        for (auto &[pos, field] : persistentFields) {
+            std::vector<Item> items;
 
-        persistentFields.emplace(pos, std::move(field));
+            if (const auto stack = stacks.find(pos); stack != stacks.end()) {
+                items.reserve(stack->second.size());
+
+                for (auto &stackItem : stack->second) {
+                    items.push_back(std::move(stackItem.second));
+                }
+            }
+
+            field.restoreItems(std::move(items));
+        }
+    } catch (std::exception &e) {
+        Logger::error(LogFacility::World) << "Error while loading persistent fields: " << e.what() << Log::end;
     }
+
+    const auto loadTime = duration_cast<milliseconds>(steady_clock::now() - startTime).count();
+    Logger::info(LogFacility::World) << "Loaded " << persistentFields.size() << " persistent fields in " << loadTime
+                                     << " ms." << Log::end;
 }
 
 void WorldMap::saveToDisk() const {
@@ -480,6 +601,11 @@ void WorldMap::makePersistentAt(const position &pos) {
             insertPersistent(std::move(newField));
         } catch (FieldNotFound &) {
             Field newField(pos);
+
+            if (Data::triggers().exists(pos)) {
+                newField.setTrigger();
+            }
+
             insertPersistent(std::move(newField));
         }
     }
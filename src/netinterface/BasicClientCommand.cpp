@@ -19,68 +19,94 @@
 #include "BasicClientCommand.hpp"
 
 #include "BasicCommand.hpp"
+#include "netinterface/ClientCommandPool.hpp"
 
 #include <climits>
+#include <numeric>
 
 BasicClientCommand::BasicClientCommand(unsigned char defByte, uint16_t minAP) : BasicCommand(defByte), minAP(minAP) {}
 
+BasicClientCommand::~BasicClientCommand() { ClientCommandPool::returnBuffer(std::move(msg_buffer)); }
+
 void BasicClientCommand::setHeaderData(uint16_t mlength, uint16_t mcheckSum) {
     length = mlength;
     checkSum = mcheckSum;
+
+    if (msg_buffer.capacity() == 0) {
+        msg_buffer = ClientCommandPool::takeBuffer();
+    }
+
+    if (msg_buffer.capacity() < length) {
+        ClientCommandPool::countBufferAllocation();
+    }
+
     msg_buffer.resize(length);
+    frameData = msg_buffer.data();
 }
 
-auto BasicClientCommand::msg_data() -> std::vector<unsigned char> & { return msg_buffer; }
+void BasicClientCommand::setFrameData(uint16_t mlength, uint16_t mcheckSum, const unsigned char *data) {
+    length = mlength;
+    checkSum = mcheckSum;
+    frameData = data;
+}
 
-auto BasicClientCommand::getUnsignedCharFromBuffer() -> unsigned char {
-    unsigned char ret = 0;
+auto BasicClientCommand::msg_data() -> std::vector<unsigned char> & { return msg_buffer; }
 
-    // no buffer available but we want to read from it
-    if (length == 0) {
-        dataOk = false;
-    }
-    // we want to read more data than there is in the buffer
-    else if (bytesRetrieved > length) {
-        dataOk = false;
-        throw OverflowException();
-    }
-    // all went well
-    else {
-        ret = msg_buffer.at(bytesRetrieved++);
+auto BasicClientCommand::takeFromBuffer(uint16_t count) -> const unsigned char * {
+    if (overflown || count > length - bytesRetrieved) {
+        overflown = true;
+        return nullptr;
     }
 
-    crc += ret;
-    return ret;
+    const auto *data = frameData + bytesRetrieved;
+    bytesRetrieved += count;
+    return data;
 }
 
-auto BasicClientCommand::getStringFromBuffer() -> std::string {
-    unsigned short int len = getShortIntFromBuffer();
+auto BasicClientCommand::getUnsignedCharFromBuffer() -> unsigned char {
+    const auto *data = takeFromBuffer(1);
+    return data != nullptr ? data[0] : 0;
+}
 
-    std::string ret;
+auto BasicClientCommand::getStringFromBuffer() -> std::string {
+    const auto len = static_cast<uint16_t>(getShortIntFromBuffer());
+    const auto *data = takeFromBuffer(len);
 
-    for (int i = 0; i < len; ++i) {
-        ret.append(1, getUnsignedCharFromBuffer());
+    if (data == nullptr) {
+        return {};
     }
 
-    return ret;
+    return {reinterpret_cast<const char *>(data), len};
 }
 
 auto BasicClientCommand::getIntFromBuffer() -> int {
-    int ret = getUnsignedCharFromBuffer() << 3 * CHAR_BIT;
-    ret = ret | (getUnsignedCharFromBuffer() << 2 * CHAR_BIT);
-    ret = ret | (getUnsignedCharFromBuffer() << CHAR_BIT);
-    ret = ret | getUnsignedCharFromBuffer();
-    return ret;
+    const auto *data = takeFromBuffer(4);
+
+    if (data == nullptr) {
+        return 0;
+    }
+
+    return static_cast<int>((uint32_t(data[0]) << 3 * CHAR_BIT) | (uint32_t(data[1]) << 2 * CHAR_BIT) |
+                            (uint32_t(data[2]) << CHAR_BIT) | uint32_t(data[3]));
 }
 
 auto BasicClientCommand::getShortIntFromBuffer() -> short int {
-    auto ret = static_cast<short int>(getUnsignedCharFromBuffer() << CHAR_BIT);
-    ret = static_cast<short int>(ret | getUnsignedCharFromBuffer());
-    return ret;
+    const auto *data = takeFromBuffer(2);
+
+    if (data == nullptr) {
+        return 0;
+    }
+
+    return static_cast<short int>((data[0] << CHAR_BIT) | data[1]);
 }
 
 auto BasicClientCommand::isDataOk() const -> bool {
+    if (overflown || length != bytesRetrieved) {
+        return false;
+    }
+
     constexpr auto allBitsSet = 0xFFFF;
+    const auto crc = std::accumulate(frameData, frameData + length, uint32_t{0});
     auto crcCheck = static_cast<uint16_t>(crc % allBitsSet);
-    return (dataOk && (length == bytesRetrieved) && (crcCheck == checkSum));
+    return crcCheck == checkSum;
 }
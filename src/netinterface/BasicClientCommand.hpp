@@ -28,7 +28,6 @@
 #include <vector>
 
 class Player;
-class OverflowException {};
 
 class BasicClientCommand;
 using ClientCommandPointer = std::shared_ptr<BasicClientCommand>;
@@ -41,9 +40,22 @@ public:
      */
     BasicClientCommand(unsigned char defByte, uint16_t minAP = 0);
 
+    /**
+     * prepares the command's own buffer to receive the data of a command
+     * @param mlength the length of the data
+     * @param mcheckSum the checksum transmitted in the header
+     */
     void setHeaderData(uint16_t mlength, uint16_t mcheckSum);
 
-    virtual ~BasicClientCommand() = default;
+    /**
+     * lets the command decode its data straight from a receive buffer without copying it
+     * @param mlength the length of the data
+     * @param mcheckSum the checksum transmitted in the header
+     * @param data the data, which has to stay valid until decodeData() and isDataOk() are done
+     */
+    void setFrameData(uint16_t mlength, uint16_t mcheckSum, const unsigned char *data);
+
+    virtual ~BasicClientCommand();
 
     auto operator=(const BasicClientCommand &) -> BasicClientCommand & = delete;
     BasicClientCommand(BasicClientCommand const &) = delete;
@@ -55,6 +67,11 @@ public:
      **/
     auto msg_data() -> std::vector<unsigned char> &;
 
+    /**
+     * returns the data the command is decoded from
+     **/
+    [[nodiscard]] auto getFrameData() const -> const unsigned char * { return frameData; }
+
     /**
      * virtual function which should be overloaded in the concrete classes to get the data
      * of the command
@@ -79,6 +96,12 @@ public:
      */
     [[nodiscard]] auto isDataOk() const -> bool;
 
+    /**
+     * returns if the command tried to read more data than was received
+     * @return true if the command is malformed
+     */
+    [[nodiscard]] auto isOverflown() const -> bool { return overflown; }
+
     /**
      * reads an unsigned char from the local command buffer
      * @return the char which was found in the buffer
@@ -115,16 +138,23 @@ public:
     inline void setReceivedTime() { incomingTime = std::chrono::steady_clock::now(); }
 
 protected:
-    bool dataOk = true; /*<true if data is ok, will set to false if a command wants to read more data from the buffer as
-                    is in it, or if the checksum isn't the same*/
-    std::vector<unsigned char> msg_buffer{}; /*< the current buffer for this command*/
-    uint16_t length = 0;                     /*< the length of this command */
-    uint16_t bytesRetrieved = 0;             /*< how much bytes are currently decoded */
-    uint16_t checkSum = 0;                   /*< the checksum transmitted in the header*/
-    uint32_t crc = 0;                        /*< the checksum of the data*/
+    bool overflown = false; /*<true if a command wanted to read more data from the buffer as is in it*/
+    std::vector<unsigned char> msg_buffer{};  /*< the current buffer for this command*/
+    const unsigned char *frameData = nullptr; /*< the data to decode, either msg_buffer or a receive buffer*/
+    uint16_t length = 0;                      /*< the length of this command */
+    uint16_t bytesRetrieved = 0;              /*< how much bytes are currently decoded */
+    uint16_t checkSum = 0;                    /*< the checksum transmitted in the header*/
 
     uint16_t minAP; /*< number of ap necessary to perform command */
     std::chrono::steady_clock::time_point incomingTime;
+
+private:
+    /**
+     * takes the next bytes from the buffer
+     * @param count the number of bytes to take
+     * @return pointer to the first byte or nullptr if there are not enough bytes left
+     */
+    auto takeFromBuffer(uint16_t count) -> const unsigned char *;
 };
 
 #endif
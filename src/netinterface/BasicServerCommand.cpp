@@ -19,27 +19,15 @@
 #include "BasicServerCommand.hpp"
 
 #include "BasicCommand.hpp"
-#include "Logger.hpp"
 #include "netinterface/NetInterface.hpp"
 
-#include <algorithm>
-#include <cassert>
 #include <climits>
-#include <iostream>
+#include <numeric>
 
-BasicServerCommand::BasicServerCommand(unsigned char defByte) : BasicCommand(defByte) {
-    buffer.resize(baseBufferSize);
-    initHeader();
-}
-
-BasicServerCommand::BasicServerCommand(unsigned char defByte, uint16_t bsize)
-        : BasicCommand(defByte), baseBufferSize(bsize) {
-    buffer.resize(baseBufferSize);
-    initHeader();
-}
+BasicServerCommand::BasicServerCommand(unsigned char defByte) : BasicCommand(defByte) { initHeader(); }
 
 void BasicServerCommand::initHeader() {
-    bufferPos = 0; // reset buffer position to 0 from previous use
+    buffer.clear(); // reset buffer from previous use
     addUnsignedCharToBuffer(getDefinitionByte());
     addUnsignedCharToBuffer(getDefinitionByte() xor UCHAR_MAX);
     addShortIntToBuffer(0); // dummy for the length
@@ -48,27 +36,43 @@ void BasicServerCommand::initHeader() {
 }
 
 void BasicServerCommand::addHeader() {
-    if (bufferPos >= headerSize) { // check if the buffer is large enough to add the data
+    if (buffer.size() >= headerSize) { // check if the buffer is large enough to add the data
         constexpr auto twoBytesSet = 0xFFFF;
         const auto crc = static_cast<int16_t>(checkSum % twoBytesSet);
-        const auto dataSize = bufferPos - headerSize;
+        const auto dataSize = buffer.size() - headerSize;
 
-        buffer.at(lengthPosition) = (dataSize >> CHAR_BIT);
-        buffer.at(lengthPosition + 1) = (dataSize & UCHAR_MAX);
+        buffer[lengthPosition] = static_cast<char>(dataSize >> CHAR_BIT);
+        buffer[lengthPosition + 1] = static_cast<char>(dataSize & UCHAR_MAX);
 
-        buffer.at(crcPosition) = (crc >> CHAR_BIT);
-        buffer.at(crcPosition + 1) = (crc & UCHAR_MAX);
+        buffer[crcPosition] = static_cast<char>(crc >> CHAR_BIT);
+        buffer[crcPosition + 1] = static_cast<char>(crc & UCHAR_MAX);
     }
 }
 
-auto BasicServerCommand::getLength() const -> int { return bufferPos; }
+auto BasicServerCommand::getLength() const -> int { return static_cast<int>(buffer.size()); }
 
-auto BasicServerCommand::cmdData() const -> const std::vector<char> & { return buffer; }
+auto BasicServerCommand::cmdData() const -> const char * { return buffer.data(); }
+
+void BasicServerCommand::reserveData(size_t dataSize) { buffer.reserve(headerSize + dataSize); }
 
 void BasicServerCommand::addStringToBuffer(const std::string &data) {
     auto count = static_cast<short int>(data.length());
     addShortIntToBuffer(count);
-    std::for_each(data.cbegin(), data.cend(), [this](auto c) { addUnsignedCharToBuffer(c); });
+    buffer.insert(buffer.end(), data.cbegin(), data.cend());
+    checkSum = std::accumulate(data.cbegin(), data.cend(), checkSum,
+                               [](uint32_t sum, char c) { return sum + static_cast<unsigned char>(c); });
+}
+
+void BasicServerCommand::setCoalescingKey(uint64_t entity) {
+    constexpr auto entityBits = 56;
+    constexpr auto entityMask = (uint64_t{1} << entityBits) - 1;
+    coalescingKey = (uint64_t{getDefinitionByte()} << entityBits) | (entity & entityMask);
+}
+
+void BasicServerCommand::addBytesToBuffer(const char *data, size_t size) {
+    buffer.insert(buffer.end(), data, data + size);
+    checkSum = std::accumulate(data, data + size, checkSum,
+                               [](uint32_t sum, char c) { return sum + static_cast<unsigned char>(c); });
 }
 
 void BasicServerCommand::addIntToBuffer(int data) {
@@ -84,24 +88,8 @@ void BasicServerCommand::addShortIntToBuffer(short int data) {
 }
 
 void BasicServerCommand::addUnsignedCharToBuffer(unsigned char data) {
-    // resize the buffer if there is not enough place to store
-    if ((bufferPos + 1) >= (bufferSizeMod * baseBufferSize)) {
-        resizeBuffer();
-    }
-
-    assert(bufferPos < (bufferSizeMod * baseBufferSize));
-    buffer.at(bufferPos) = data;
+    buffer.push_back(static_cast<char>(data));
     checkSum += data; // add the data to the checksum
-    bufferPos++;
-}
-
-void BasicServerCommand::resizeBuffer() {
-    Logger::info(LogFacility::Other) << "Not enough memory. Resizing the send buffer. Current size: "
-                                     << bufferSizeMod * baseBufferSize << " bytes." << Log::end;
-    bufferSizeMod *= 2;
-    buffer.resize(bufferSizeMod * baseBufferSize);
-    Logger::info(LogFacility::Other) << "Resizing the send buffer successful. New size: "
-                                     << bufferSizeMod * baseBufferSize << " bytes." << Log::end;
 }
 
 void BasicServerCommand::addColourToBuffer(const Colour &c) {
@@ -21,11 +21,11 @@
 
 #include "netinterface/BasicCommand.hpp"
 
+#include <boost/container/small_vector.hpp>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <types.hpp>
-#include <vector>
 
 class BasicServerCommand;
 using ServerCommandPointer = std::shared_ptr<BasicServerCommand>;
@@ -45,18 +45,11 @@ class BasicServerCommand : public BasicCommand {
 public:
     /**
      * Constructor which creates the server command.
-     * In this case the internal data buffer is 1000 bytes large.
+     * Small commands are stored inside the command itself, larger ones grow their buffer on demand.
      * @param defByte The id of this command
      */
     explicit BasicServerCommand(unsigned char defByte);
 
-    /**
-     * Constructor which creates the server command.
-     * @param defByte The id of this command
-     * @param bsize The initial buffer size of this command
-     */
-    BasicServerCommand(unsigned char defByte, uint16_t bsize);
-
     auto operator=(const BasicServerCommand &) -> BasicServerCommand & = delete;
     BasicServerCommand(const BasicServerCommand &) = delete;
     BasicServerCommand(BasicServerCommand &&) = default;
@@ -67,7 +60,7 @@ public:
      * Function which returns the data buffer of the command.
      * @return The data buffer of the command
      */
-    [[nodiscard]] auto cmdData() const -> const std::vector<char> &;
+    [[nodiscard]] auto cmdData() const -> const char *;
 
     /**
      * Returns the length of the command in bytes
@@ -88,21 +81,53 @@ public:
     void addHeader();
     void initHeader();
 
+    /**
+     * Returns the key of the state this command updates, commands with equal keys supersede each other
+     * @return The key, 0 if the command can not be superseded
+     */
+    [[nodiscard]] auto getCoalescingKey() const -> uint64_t { return coalescingKey; }
+
+protected:
+    /**
+     * Reserves buffer space for commands whose size is known before encoding
+     * @param dataSize The number of data bytes following the header
+     */
+    void reserveData(size_t dataSize);
+
+    /**
+     * Appends raw bytes without a length prefix, e.g. for already encoded payloads
+     * @param data Pointer to the first byte
+     * @param size Number of bytes to append
+     */
+    void addBytesToBuffer(const char *data, size_t size);
+
+    /**
+     * Marks this command as a state update of the given entity, so a newer update may replace it while unsent
+     * @param entity The id of the entity whose state is sent, only the lower 56 bits are used
+     */
+    void setCoalescingKey(uint64_t entity);
+
+    /**
+     * Lets this command supersede the same state as another one, e.g. when wrapping it
+     * @param command The command whose key is taken over
+     */
+    void copyCoalescingKey(const BasicServerCommand &command) { coalescingKey = command.coalescingKey; }
+
 private:
+    friend class CompressedTC;
+
     static constexpr uint16_t headerSize = 6;
     static constexpr uint16_t lengthPosition = 2;
     static constexpr uint16_t crcPosition = 4;
-    static constexpr uint16_t defaultBufferSize = 1000;
-    uint16_t baseBufferSize = defaultBufferSize;
+    // large enough for all fixed size commands like MoveAckTC, so these need no extra allocation
+    static constexpr size_t inlineBufferSize = 32;
 
-    std::vector<char> buffer;
+    boost::container::small_vector<char, inlineBufferSize> buffer;
     uint32_t checkSum = 0;
-
-    uint16_t bufferPos = 0;     // stores the current buffer position and the size of the used buffer
-    uint16_t bufferSizeMod = 1; // bufferSizeMod * baseBufferSize = current buffer size
-
-    // if there is a buffer overflow this function doubles buffer size
-    void resizeBuffer();
+    uint64_t coalescingKey = 0;
+    // compressed form shared by all connections sending this command, filled on first use
+    ServerCommandPointer compressedCommand;
+    bool compressionTried = false;
 };
 
 #endif
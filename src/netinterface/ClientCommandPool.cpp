@@ -0,0 +1,95 @@
+//  illarionserver - server for the game Illarion
+//  Copyright 2011 Illarion e.V.
+//
+//  This file is part of illarionserver.
+//
+//  illarionserver is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  illarionserver is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with illarionserver.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "netinterface/ClientCommandPool.hpp"
+
+#include <new>
+
+std::atomic<uint64_t> ClientCommandPool::commands{0};
+std::atomic<uint64_t> ClientCommandPool::blockAllocations{0};
+std::atomic<uint64_t> ClientCommandPool::bufferAllocations{0};
+
+auto ClientCommandPool::freeLists() -> FreeLists & {
+    static auto *lists = new FreeLists();
+    return *lists;
+}
+
+auto ClientCommandPool::allocate(size_t size) -> void * {
+    {
+        auto &lists = freeLists();
+        std::lock_guard<std::mutex> lock(lists.mutex);
+        auto &blocks = lists.blocks[size];
+
+        if (!blocks.empty()) {
+            void *block = blocks.back();
+            blocks.pop_back();
+            return block;
+        }
+    }
+
+    ++blockAllocations;
+    return ::operator new(size);
+}
+
+void ClientCommandPool::deallocate(void *block, size_t size) noexcept {
+    try {
+        auto &lists = freeLists();
+        std::lock_guard<std::mutex> lock(lists.mutex);
+        auto &blocks = lists.blocks[size];
+
+        if (blocks.size() < maxFreeBlocks) {
+            blocks.push_back(block);
+            return;
+        }
+    } catch (...) {
+    }
+
+    ::operator delete(block);
+}
+
+auto ClientCommandPool::takeBuffer() -> std::vector<unsigned char> {
+    auto &lists = freeLists();
+    std::lock_guard<std::mutex> lock(lists.mutex);
+
+    if (lists.buffers.empty()) {
+        return {};
+    }
+
+    auto buffer = std::move(lists.buffers.back());
+    lists.buffers.pop_back();
+    return buffer;
+}
+
+void ClientCommandPool::returnBuffer(std::vector<unsigned char> &&buffer) noexcept {
+    if (buffer.capacity() == 0 || buffer.capacity() > maxBufferCapacity) {
+        return;
+    }
+
+    try {
+        auto &lists = freeLists();
+        std::lock_guard<std::mutex> lock(lists.mutex);
+
+        if (lists.buffers.size() < maxFreeBuffers) {
+            buffer.clear();
+            lists.buffers.push_back(std::move(buffer));
+        }
+    } catch (...) {
+    }
+}
+
+auto ClientCommandPool::getStats() -> Stats { return {commands, blockAllocations, bufferAllocations}; }
@@ -0,0 +1,91 @@
+//  illarionserver - server for the game Illarion
+//  Copyright 2011 Illarion e.V.
+//
+//  This file is part of illarionserver.
+//
+//  illarionserver is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Affero General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  illarionserver is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Affero General Public License for more details.
+//
+//  You should have received a copy of the GNU Affero General Public License
+//  along with illarionserver.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CLIENT_COMMAND_POOL_HPP
+#define CLIENT_COMMAND_POOL_HPP
+
+#include "netinterface/BasicClientCommand.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ *recycles the memory of decoded client commands and their message buffers,
+ *commands are created by the network threads and released by the game loop
+ */
+class ClientCommandPool {
+public:
+    struct Stats {
+        uint64_t commands;
+        uint64_t blockAllocations;
+        uint64_t bufferAllocations;
+    };
+
+    static auto allocate(size_t size) -> void *;
+    static void deallocate(void *block, size_t size) noexcept;
+
+    static auto takeBuffer() -> std::vector<unsigned char>;
+    static void returnBuffer(std::vector<unsigned char> &&buffer) noexcept;
+
+    static void countCommand() { ++commands; }
+    static void countBufferAllocation() { ++bufferAllocations; }
+    static auto getStats() -> Stats;
+
+private:
+    static constexpr size_t maxFreeBlocks = 256;
+    static constexpr size_t maxFreeBuffers = 256;
+    static constexpr size_t maxBufferCapacity = 4096;
+
+    struct FreeLists {
+        std::mutex mutex;
+        std::unordered_map<size_t, std::vector<void *>> blocks;
+        std::vector<std::vector<unsigned char>> buffers;
+    };
+
+    // never destroyed, commands may still be released during static destruction
+    static auto freeLists() -> FreeLists &;
+
+    static std::atomic<uint64_t> commands;
+    static std::atomic<uint64_t> blockAllocations;
+    static std::atomic<uint64_t> bufferAllocations;
+};
+
+template <typename T> class PooledCommandAllocator {
+public:
+    using value_type = T;
+
+    PooledCommandAllocator() = default;
+    template <typename U> PooledCommandAllocator(const PooledCommandAllocator<U> & /*unused*/) {}
+
+    auto allocate(size_t n) -> T * { return static_cast<T *>(ClientCommandPool::allocate(n * sizeof(T))); }
+    void deallocate(T *block, size_t n) noexcept { ClientCommandPool::deallocate(block, n * sizeof(T)); }
+
+    template <typename U> auto operator==(const PooledCommandAllocator<U> & /*unused*/) const -> bool { return true; }
+};
+
+template <typename T> auto makePooledCommand() -> ClientCommandPointer {
+    ClientCommandPool::countCommand();
+    return std::allocate_shared<T>(PooledCommandAllocator<T>());
+}
+
+#endif
@@ -79,11 +79,10 @@ CommandFactory::CommandFactory() {
 }
 
 auto CommandFactory::getCommand(unsigned char commandId) -> ClientCommandPointer {
-    COMMANDLIST::iterator it;
-    it = templateList.find(commandId);
+    const auto &commandTemplate = templateList[commandId];
 
-    if (it != templateList.end()) {
-        return it->second->clone();
+    if (commandTemplate) {
+        return commandTemplate->clone();
     }
 
     return ClientCommandPointer();
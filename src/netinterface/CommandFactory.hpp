@@ -21,8 +21,9 @@
 
 #include "netinterface/BasicClientCommand.hpp"
 
+#include <array>
+#include <climits>
 #include <memory>
-#include <unordered_map>
 
 /**
  *factory class which holds templates of BasicServerCommand classes
@@ -40,7 +41,7 @@ public:
     auto getCommand(unsigned char commandId) -> ClientCommandPointer;
 
 private:
-    using COMMANDLIST = std::unordered_map<unsigned char, std::unique_ptr<BasicClientCommand>>;
+    using COMMANDLIST = std::array<std::unique_ptr<BasicClientCommand>, UCHAR_MAX + 1>;
     COMMANDLIST templateList;
 };
 
@@ -19,15 +19,22 @@
 #include "netinterface/NetInterface.hpp"
 
 #include "CommandFactory.hpp"
+#include "Config.hpp"
 #include "Player.hpp"
 #include "netinterface/BasicClientCommand.hpp"
 #include "netinterface/protocol/ClientCommands.hpp"
+#include "netinterface/protocol/ServerCommands.hpp"
 
+#include <algorithm>
 #include <climits>
 #include <iomanip>
+#include <sstream>
+
+std::atomic<uint64_t> NetInterface::slowClientDisconnects = 0;
+std::atomic<uint64_t> NetInterface::coalescedCommands = 0;
 
 NetInterface::NetInterface(boost::asio::io_service &io_servicen)
-        : online(false), headerBuffer{0}, socket(io_servicen), inactive(0), owner(nullptr) {
+        : online(false), socket(io_servicen), inactive(0), owner(nullptr) {
     cmd.reset();
 }
 
@@ -49,12 +56,11 @@ void NetInterface::closeConnection() { online = false; }
 auto NetInterface::activate(Player *player) -> bool {
     try {
         owner = player;
-        boost::asio::async_read(socket, boost::asio::buffer(headerBuffer),
-                                [shared_this = shared_from_this()](const auto &error, auto bytes_transferred) {
-                                    shared_this->handle_read_header(error);
-                                });
         ipadress = socket.remote_endpoint().address().to_string();
         online = true;
+        // commands received together with the login are still buffered, parse them on the io thread before reading on
+        boost::asio::post(socket.get_executor(),
+                          [shared_this = shared_from_this()] { shared_this->handle_receive({}, 0); });
         return true;
     } catch (std::exception &e) {
         if (player != nullptr) {
@@ -68,152 +74,204 @@ auto NetInterface::activate(Player *player) -> bool {
     }
 }
 
-void NetInterface::handle_read_data(const boost::system::error_code &error) {
+void NetInterface::startReceive() {
+    socket.async_read_some(
+            boost::asio::buffer(receiveBuffer.data() + receiveEnd, receiveBuffer.size() - receiveEnd),
+            [shared_this = shared_from_this()](const auto &error, auto bytes_transferred) {
+                shared_this->handle_receive(error, bytes_transferred);
+            });
+}
+
+void NetInterface::handle_receive(const boost::system::error_code &error, size_t bytes_transferred) {
     if (!error) {
-        if (online) {
-            try {
-                cmd->decodeData();
+        receiveEnd += bytes_transferred;
 
-                if (cmd->isDataOk()) {
-                    cmd->setReceivedTime();
+        if (online && parseFrames()) {
+            startReceive();
+        }
+    } else {
+        if (online) {
+            std::string errorMsg = error.message();
 
-                    if (owner == nullptr) {
-                        auto login = std::dynamic_pointer_cast<LoginCommandTS>(cmd);
+            // Handle specific errors
+            if (error == boost::asio::error::eof) {
+                errorMsg = "Connection closed by remote peer (EOF)";
+            } else if (error == boost::asio::error::operation_aborted) {
+                errorMsg = "Operation aborted (possible shutdown or timeout)";
+            } else if (error == boost::asio::error::connection_reset) {
+                errorMsg = "Connection reset by peer";
+            }
 
-                        if (!login) {
-                            closeConnection();
-                            return;
-                        }
+            // Log the error with additional context
+            if (owner != nullptr) {
+                Logger::error(LogFacility::Other) << "Error in NetInterface::handle_receive for " << owner->to_string()
+                                                  << " from " << getIPAdress() << ": " << errorMsg << Log::end;
+            } else {
+                Logger::error(LogFacility::Other) << "Error in NetInterface::handle_receive from " << getIPAdress()
+                                                  << ": " << errorMsg << Log::end;
+            }
+        }
 
-                        loginData = login;
-                        return;
-                    }
-                    owner->receiveCommand(cmd);
-                }
-            } catch (OverflowException &e) {
-                std::ostringstream message;
-                message << "Overflow while reading from buffer from ";
-                message << getIPAdress() << ": ";
+        // Close the connection regardless of the error type
+        closeConnection();
+    }
+}
 
-                const auto &data = cmd->msg_data();
-                message << std::hex << std::uppercase << std::setfill('0');
+auto NetInterface::parseFrames() -> bool {
+    while (online && receiveEnd - receiveStart >= headerSize) {
+        const auto *header = &receiveBuffer.at(receiveStart);
 
-                for (int i = 0; i < cmd->getLength(); ++i) {
-                    message << std::setw(2) << (int)data.at(i) << " ";
-                }
+        // no correct header, skip bytes until a valid command id shows up
+        if ((header[commandPosition] xor UCHAR_MAX) != header[commandPosition + 1]) {
+            ++receiveStart;
+            continue;
+        }
 
-                message << std::dec << std::nouppercase;
-                Logger::error(LogFacility::Other) << message.str() << Log::end;
+        const uint16_t length = (header[lengthPosition] << CHAR_BIT) | header[lengthPosition + 1];
+        const uint16_t checkSum = (header[crcPosition] << CHAR_BIT) | header[crcPosition + 1];
+        cmd = commandFactory.getCommand(header[commandPosition]);
 
-                closeConnection();
-            }
+        if (!cmd) {
+            ++receiveStart;
+            continue;
+        }
 
-            cmd.reset();
-            boost::asio::async_read(socket, boost::asio::buffer(headerBuffer),
+        const size_t frameSize = headerSize + length;
+        const size_t available = receiveEnd - receiveStart;
+
+        if (frameSize > receiveBuffer.size()) {
+            // too large for the receive buffer, the rest is read into the command's own buffer
+            const size_t buffered = available - headerSize;
+            cmd->setHeaderData(length, checkSum);
+            std::copy_n(header + headerSize, buffered, cmd->msg_data().begin());
+            receiveStart = 0;
+            receiveEnd = 0;
+            boost::asio::async_read(socket, boost::asio::buffer(cmd->msg_data().data() + buffered, length - buffered),
                                     [shared_this = shared_from_this()](const auto &error, auto bytes_transferred) {
-                                        shared_this->handle_read_header(error);
+                                        shared_this->handle_read_data(error);
                                     });
+            return false;
+        }
+
+        if (available < frameSize) {
+            cmd.reset();
+            break;
+        }
+
+        cmd->setFrameData(length, checkSum, header + headerSize);
+        receiveStart += frameSize;
+
+        if (!processCommand()) {
+            compactReceiveBuffer();
+            return false;
         }
-    } else {
-        closeConnection();
-        boost::asio::async_read(socket, boost::asio::buffer(headerBuffer),
-                                [shared_this = shared_from_this()](const auto &error, auto bytes_transferred) {
-                                    shared_this->handle_read_header(error);
-                                });
     }
+
+    compactReceiveBuffer();
+    return online;
 }
 
-auto NetInterface::nextInactive() -> bool {
-    inactive++;
-    return (inactive > maxInactive);
+void NetInterface::compactReceiveBuffer() {
+    std::copy(receiveBuffer.begin() + receiveStart, receiveBuffer.begin() + receiveEnd, receiveBuffer.begin());
+    receiveEnd -= receiveStart;
+    receiveStart = 0;
 }
 
-void NetInterface::handle_read_header(const boost::system::error_code &error) {
+void NetInterface::handle_read_data(const boost::system::error_code &error) {
     if (!error) {
-        if ((headerBuffer[commandPosition] xor UCHAR_MAX) == headerBuffer[commandPosition + 1]) {
-            // Correcter header decodieren und comand empfangen
-            uint16_t length = headerBuffer[lengthPosition] << CHAR_BIT;
-            length = length | headerBuffer[lengthPosition + 1];
-            uint16_t checkSum = headerBuffer[crcPosition] << CHAR_BIT;
-            checkSum = checkSum | headerBuffer[crcPosition + 1];
-            cmd = commandFactory.getCommand(headerBuffer[commandPosition]);
-
-            if (cmd) {
-                cmd->setHeaderData(length, checkSum);
-                boost::asio::async_read(socket, boost::asio::buffer(cmd->msg_data(), cmd->getLength()),
-                                        [shared_this = shared_from_this()](const auto &error, auto bytes_transferred) {
-                                            shared_this->handle_read_data(error);
-                                        });
-
-                return;
-            }
+        if (online && processCommand()) {
+            startReceive();
         }
+    } else {
+        handle_receive(error, 0);
+    }
+}
 
-        // no correct header
-
-        // look for command id in header
-        for (int i = 1; i < headerSize - 1; ++i) {
-            // found correct command id
-            if ((headerBuffer.at(i) xor UCHAR_MAX) == headerBuffer.at(i + 1)) {
-                // copy the rest of the correct message to the start of the buffer
-                int start = 0;
+auto NetInterface::processCommand() -> bool {
+    cmd->decodeData();
 
-                while (i < headerSize) {
-                    headerBuffer.at(start++) = headerBuffer.at(i++);
-                }
+    if (cmd->isOverflown()) {
+        std::ostringstream message;
+        message << "Overflow while reading from buffer from ";
+        message << getIPAdress() << ": ";
 
-                // restheader empfangen
-                boost::asio::async_read(socket, boost::asio::buffer(&headerBuffer.at(start), headerSize - start),
-                                        [shared_this = shared_from_this()](const auto &error, auto bytes_transferred) {
-                                            shared_this->handle_read_header(error);
-                                        });
+        const auto *data = cmd->getFrameData();
+        message << std::hex << std::uppercase << std::setfill('0');
 
-                return;
-            }
+        for (int i = 0; i < cmd->getLength(); ++i) {
+            message << std::setw(2) << (int)data[i] << " ";
         }
 
-        // Keine Command Signature gefunden wieder 6 Byte Header auslesen
-        boost::asio::async_read(socket, boost::asio::buffer(headerBuffer),
-                                [shared_this = shared_from_this()](const auto &error, auto bytes_transferred) {
-                                    shared_this->handle_read_header(error);
-                                });
+        message << std::dec << std::nouppercase;
+        Logger::error(LogFacility::Other) << message.str() << Log::end;
 
-    } else {
-        if (online) {
-            std::string errorMsg = error.message();
+        cmd.reset();
+        closeConnection();
+        return false;
+    }
 
-            // Handle specific errors
-            if (error == boost::asio::error::eof) {
-                errorMsg = "Connection closed by remote peer (EOF)";
-            } else if (error == boost::asio::error::operation_aborted) {
-                errorMsg = "Operation aborted (possible shutdown or timeout)";
-            } else if (error == boost::asio::error::connection_reset) {
-                errorMsg = "Connection reset by peer";
-            }
+    if (cmd->isDataOk()) {
+        cmd->setReceivedTime();
 
-            // Log the error with additional context
-            if (owner != nullptr) {
-                Logger::error(LogFacility::Other)
-                    << "Error in NetInterface::handle_read_header for " << owner->to_string()
-                    << " from " << getIPAdress() << ": " << errorMsg << Log::end;
-            } else {
-                Logger::error(LogFacility::Other)
-                    << "Error in NetInterface::handle_read_header from " << getIPAdress()
-                    << ": " << errorMsg << Log::end;
+        if (owner == nullptr) {
+            auto login = std::dynamic_pointer_cast<LoginCommandTS>(cmd);
+            cmd.reset();
+
+            if (!login) {
+                closeConnection();
+                return false;
             }
+
+            // processing stops until the connection is activated for the new player
+            loginData = login;
+            return false;
         }
 
-    // Close the connection regardless of the error type
-    closeConnection();
+        owner->receiveCommand(cmd);
     }
+
+    cmd.reset();
+    return true;
+}
+
+auto NetInterface::nextInactive() -> bool {
+    inactive++;
+    return (inactive > maxInactive);
 }
 
 void NetInterface::addCommand(const ServerCommandPointer &command) {
     if (online) {
         command->addHeader();
+        const auto toSend = (compression && command->getLength() >= compressionThreshold)
+                                    ? CompressedTC::compress(command)
+                                    : command;
         std::lock_guard<std::mutex> lock(sendQueueMutex);
         bool write_in_progress = !sendQueue.empty();
-        sendQueue.push_back(command);
+        supersedeQueuedState(command->getCoalescingKey());
+        sendQueue.push_back(toSend);
+        queuedBytes += toSend->getLength();
+
+        if (command->getCoalescingKey() != 0) {
+            latestState[command->getCoalescingKey()] = &sendQueue.back();
+        }
+
+        constexpr size_t bytesPerKilobyte = 1024;
+        const size_t queueLimit = Config::instance().send_queue_limit * bytesPerKilobyte;
+
+        if (queueLimit > 0 && queuedBytes > queueLimit) {
+            Logger::warn(LogFacility::Other)
+                    << "Closing connection to " << getIPAdress() << ", client does not keep up with "
+                    << queuedBytes / bytesPerKilobyte << " KiB queued" << Log::end;
+            ++slowClientDisconnects;
+            closeConnection();
+
+            // keep the command currently being written, its buffer is still in use
+            sendQueue.erase(sendQueue.begin() + 1, sendQueue.end());
+            queuedBytes = sendQueue.front()->getLength();
+            latestState.clear();
+            supersededSlots = 0;
+            return;
+        }
 
         try {
             if (!write_in_progress && online) {
@@ -230,6 +288,55 @@ void NetInterface::addCommand(const ServerCommandPointer &command) {
     }
 }
 
+void NetInterface::supersedeQueuedState(uint64_t key) {
+    if (key == 0) {
+        return;
+    }
+
+    const auto previous = latestState.find(key);
+
+    // the front command is being written right now and can not be dropped anymore
+    if (previous == latestState.end() || previous->second == &sendQueue.front()) {
+        return;
+    }
+
+    auto &slot = *previous->second;
+    queuedBytes -= slot->getLength();
+    slot.reset();
+    ++coalescedCommands;
+    ++supersededSlots;
+
+    constexpr size_t minSlotsToCompact = 64;
+
+    if (supersededSlots >= minSlotsToCompact && supersededSlots > sendQueue.size() / 2) {
+        sendQueue.erase(std::remove(sendQueue.begin() + 1, sendQueue.end(), nullptr), sendQueue.end());
+        supersededSlots = 0;
+        latestState.clear();
+
+        for (auto &queued : sendQueue) {
+            if (queued->getCoalescingKey() != 0) {
+                latestState[queued->getCoalescingKey()] = &queued;
+            }
+        }
+    }
+}
+
+void NetInterface::popSentCommand() {
+    const auto latest = latestState.find(sendQueue.front()->getCoalescingKey());
+
+    if (latest != latestState.end() && latest->second == &sendQueue.front()) {
+        latestState.erase(latest);
+    }
+
+    queuedBytes -= sendQueue.front()->getLength();
+    sendQueue.pop_front();
+
+    while (!sendQueue.empty() && !sendQueue.front()) {
+        sendQueue.pop_front();
+        --supersededSlots;
+    }
+}
+
 void NetInterface::shutdownSend(const ServerCommandPointer &command) {
     try {
         command->addHeader();
@@ -249,7 +356,7 @@ void NetInterface::handle_write(const boost::system::error_code &error) {
         if (!error) {
             if (online) {
                 std::lock_guard<std::mutex> lock(sendQueueMutex);
-                sendQueue.pop_front();
+                popSentCommand();
 
                 if (!sendQueue.empty() && online) {
                     boost::asio::async_write(
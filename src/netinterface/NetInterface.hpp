@@ -35,6 +35,7 @@
 #include <deque>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 
 class LoginCommandTS;
 
@@ -79,6 +80,26 @@ public:
 
     void shutdownSend(const ServerCommandPointer &command);
 
+    /**
+     * lets large commands be sent compressed, only for clients which are able to decode them
+     */
+    void enableCompression() { compression = true; }
+
+    /**
+     * returns the number of bytes waiting in the send queue of this connection
+     */
+    [[nodiscard]] auto getQueuedBytes() const -> size_t { return queuedBytes; }
+
+    /**
+     * returns the number of connections closed because their client could not keep up
+     */
+    static auto getSlowClientDisconnects() -> uint64_t { return slowClientDisconnects; }
+
+    /**
+     * returns the number of queued commands dropped because a newer one replaced them
+     */
+    static auto getCoalescedCommands() -> uint64_t { return coalescedCommands; }
+
     auto getIPAdress() -> std::string;
 
     std::atomic_bool online; /*< if connection is active*/
@@ -90,18 +111,32 @@ public:
     auto getLoginData() const -> std::shared_ptr<LoginCommandTS> { return loginData; }
 
 private:
-    void handle_read_header(const boost::system::error_code &error);
+    void startReceive();
+    void handle_receive(const boost::system::error_code &error, size_t bytes_transferred);
+    // returns false if receiving must not go on right away
+    auto parseFrames() -> bool;
+    void compactReceiveBuffer();
+    // reads the rest of a command too large for the receive buffer
     void handle_read_data(const boost::system::error_code &error);
+    // decodes and forwards cmd, returns false if receiving must not go on right away
+    auto processCommand() -> bool;
 
     void handle_write(const boost::system::error_code &error);
     void handle_write_shutdown(const boost::system::error_code &error);
 
-    // Buffer for the header of messages
-    static constexpr auto headerSize = 6;
+    // both need sendQueueMutex
+    void supersedeQueuedState(uint64_t key);
+    void popSentCommand();
+
+    static constexpr size_t headerSize = 6;
     static constexpr auto commandPosition = 0;
     static constexpr auto lengthPosition = 2;
     static constexpr auto crcPosition = 4;
-    std::array<unsigned char, headerSize> headerBuffer;
+    // received data, commands are decoded from here unless they are larger than the buffer
+    static constexpr size_t receiveBufferSize = 4096;
+    std::array<unsigned char, receiveBufferSize> receiveBuffer{};
+    size_t receiveStart = 0;
+    size_t receiveEnd = 0;
 
     ClientCommandPointer cmd;
     ServerCommandPointer shutdownCmd;
@@ -109,6 +144,18 @@ private:
 
     SERVERCOMMANDLIST sendQueue;
 
+    // commands of at least this size are compressed if the client supports it
+    static constexpr auto compressionThreshold = 512;
+    std::atomic_bool compression{false};
+
+    // bytes in sendQueue, only changed while holding sendQueueMutex
+    std::atomic<size_t> queuedBytes{0};
+    // unsent state updates by coalescing key, superseded ones are left as empty slots in sendQueue
+    std::unordered_map<uint64_t, ServerCommandPointer *> latestState;
+    size_t supersededSlots = 0;
+    static std::atomic<uint64_t> slowClientDisconnects;
+    static std::atomic<uint64_t> coalescedCommands;
+
     std::string ipadress;
 
     boost::asio::ip::tcp::socket socket;
@@ -22,6 +22,7 @@
 #include "MonitoringClients.hpp"
 #include "Player.hpp"
 #include "World.hpp"
+#include "netinterface/ClientCommandPool.hpp"
 #include "netinterface/protocol/BBIWIServerCommands.hpp"
 
 BBBroadCastTS::BBBroadCastTS() : BasicClientCommand(BB_BROADCAST_TS) {}
@@ -31,7 +32,7 @@ void BBBroadCastTS::decodeData() { msg = getStringFromBuffer(); }
 void BBBroadCastTS::performAction(Player *player) { World::get()->broadcast_command(player, msg); }
 
 auto BBBroadCastTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<BBBroadCastTS>();
+    ClientCommandPointer cmd = makePooledCommand<BBBroadCastTS>();
     return cmd;
 }
 
@@ -52,7 +53,7 @@ void BBSpeakAsTS::performAction(Player *player) {
 }
 
 auto BBSpeakAsTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<BBSpeakAsTS>();
+    ClientCommandPointer cmd = makePooledCommand<BBSpeakAsTS>();
     return cmd;
 }
 
@@ -74,7 +75,7 @@ void BBWarpPlayerTS::performAction(Player *player) {
 }
 
 auto BBWarpPlayerTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<BBWarpPlayerTS>();
+    ClientCommandPointer cmd = makePooledCommand<BBWarpPlayerTS>();
     return cmd;
 }
 
@@ -105,7 +106,7 @@ void BBServerCommandTS::performAction(Player *player) {
 }
 
 auto BBServerCommandTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<BBServerCommandTS>();
+    ClientCommandPointer cmd = makePooledCommand<BBServerCommandTS>();
     return cmd;
 }
 
@@ -130,7 +131,7 @@ void BBChangeAttribTS::performAction(Player *player) {
 }
 
 auto BBChangeAttribTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<BBChangeAttribTS>();
+    ClientCommandPointer cmd = makePooledCommand<BBChangeAttribTS>();
     return cmd;
 }
 
@@ -154,7 +155,7 @@ void BBChangeSkillTS::performAction(Player *player) {
 }
 
 auto BBChangeSkillTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<BBChangeSkillTS>();
+    ClientCommandPointer cmd = makePooledCommand<BBChangeSkillTS>();
     return cmd;
 }
 
@@ -168,7 +169,7 @@ void BBTalktoTS::decodeData() {
 void BBTalktoTS::performAction(Player *player) { World::get()->talkto_command(player, std::to_string(id) + "," + msg); }
 
 auto BBTalktoTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<BBTalktoTS>();
+    ClientCommandPointer cmd = makePooledCommand<BBTalktoTS>();
     return cmd;
 }
 
@@ -179,7 +180,7 @@ void BBDisconnectTS::decodeData() {}
 void BBDisconnectTS::performAction(Player *player) { player->Connection->closeConnection(); }
 
 auto BBDisconnectTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<BBDisconnectTS>();
+    ClientCommandPointer cmd = makePooledCommand<BBDisconnectTS>();
     return cmd;
 }
 
@@ -190,7 +191,7 @@ void BBKeepAliveTS::decodeData() {}
 void BBKeepAliveTS::performAction(Player *player) { time(&(player->lastkeepalive)); }
 
 auto BBKeepAliveTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<BBKeepAliveTS>();
+    ClientCommandPointer cmd = makePooledCommand<BBKeepAliveTS>();
     return cmd;
 }
 
@@ -214,6 +215,6 @@ void BBBanTS::performAction(Player *player) {
 }
 
 auto BBBanTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<BBBanTS>();
+    ClientCommandPointer cmd = makePooledCommand<BBBanTS>();
     return cmd;
 }
@@ -29,6 +29,7 @@
 #include "data/Data.hpp"
 #include "data/MonsterTable.hpp"
 #include "map/Field.hpp"
+#include "netinterface/ClientCommandPool.hpp"
 #include "netinterface/protocol/BBIWIServerCommands.hpp"
 #include "netinterface/protocol/ServerCommands.hpp"
 #include "script/LuaItemScript.hpp"
@@ -58,7 +59,7 @@ void InputDialogTS::performAction(Player *player) {
 }
 
 auto InputDialogTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<InputDialogTS>();
+    ClientCommandPointer cmd = makePooledCommand<InputDialogTS>();
     return cmd;
 }
 
@@ -72,7 +73,7 @@ void MessageDialogTS::performAction(Player *player) {
 }
 
 auto MessageDialogTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<MessageDialogTS>();
+    ClientCommandPointer cmd = makePooledCommand<MessageDialogTS>();
     return cmd;
 }
 
@@ -127,7 +128,7 @@ void MerchantDialogTS::performAction(Player *player) {
 }
 
 auto MerchantDialogTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<MerchantDialogTS>();
+    ClientCommandPointer cmd = makePooledCommand<MerchantDialogTS>();
     return cmd;
 }
 
@@ -145,7 +146,7 @@ void SelectionDialogTS::performAction(Player *player) {
 }
 
 auto SelectionDialogTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<SelectionDialogTS>();
+    ClientCommandPointer cmd = makePooledCommand<SelectionDialogTS>();
     return cmd;
 }
 
@@ -198,7 +199,7 @@ void CraftingDialogTS::performAction(Player *player) {
 }
 
 auto CraftingDialogTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<CraftingDialogTS>();
+    ClientCommandPointer cmd = makePooledCommand<CraftingDialogTS>();
     return cmd;
 }
 
@@ -224,7 +225,7 @@ void RequestAppearanceTS::performAction(Player *player) {
 }
 
 auto RequestAppearanceTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<RequestAppearanceTS>();
+    ClientCommandPointer cmd = makePooledCommand<RequestAppearanceTS>();
     return cmd;
 }
 
@@ -284,7 +285,7 @@ void LookAtCharacterTS::performAction(Player *player) {
 }
 
 auto LookAtCharacterTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<LookAtCharacterTS>();
+    ClientCommandPointer cmd = makePooledCommand<LookAtCharacterTS>();
     return cmd;
 }
 
@@ -558,7 +559,7 @@ void CastTS::performAction(Player *player) {
 }
 
 auto CastTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<CastTS>();
+    ClientCommandPointer cmd = makePooledCommand<CastTS>();
     return cmd;
 }
 
@@ -826,7 +827,7 @@ void UseTS::performAction(Player *player) {
 }
 
 auto UseTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<UseTS>();
+    ClientCommandPointer cmd = makePooledCommand<UseTS>();
     return cmd;
 }
 
@@ -842,7 +843,7 @@ void KeepAliveTS::performAction(Player *player) {
 }
 
 auto KeepAliveTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<KeepAliveTS>();
+    ClientCommandPointer cmd = makePooledCommand<KeepAliveTS>();
     return cmd;
 }
 
@@ -856,7 +857,7 @@ void RequestSkillsTS::performAction(Player *player) {
 }
 
 auto RequestSkillsTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<RequestSkillsTS>();
+    ClientCommandPointer cmd = makePooledCommand<RequestSkillsTS>();
     return cmd;
 }
 
@@ -873,7 +874,7 @@ void AttackStopTS::performAction(Player *player) {
 }
 
 auto AttackStopTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<AttackStopTS>();
+    ClientCommandPointer cmd = makePooledCommand<AttackStopTS>();
     return cmd;
 }
 
@@ -891,7 +892,7 @@ void LookAtInventoryItemTS::performAction(Player *player) {
 }
 
 auto LookAtInventoryItemTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<LookAtInventoryItemTS>();
+    ClientCommandPointer cmd = makePooledCommand<LookAtInventoryItemTS>();
     return cmd;
 }
 
@@ -912,7 +913,7 @@ void LookAtShowCaseItemTS::performAction(Player *player) {
 }
 
 auto LookAtShowCaseItemTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<LookAtShowCaseItemTS>();
+    ClientCommandPointer cmd = makePooledCommand<LookAtShowCaseItemTS>();
     return cmd;
 }
 
@@ -938,7 +939,7 @@ void MoveItemFromPlayerToShowCaseTS::performAction(Player *player) {
 }
 
 auto MoveItemFromPlayerToShowCaseTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<MoveItemFromPlayerToShowCaseTS>();
+    ClientCommandPointer cmd = makePooledCommand<MoveItemFromPlayerToShowCaseTS>();
     return cmd;
 }
 
@@ -964,7 +965,7 @@ void MoveItemFromShowCaseToPlayerTS::performAction(Player *player) {
 }
 
 auto MoveItemFromShowCaseToPlayerTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<MoveItemFromShowCaseToPlayerTS>();
+    ClientCommandPointer cmd = makePooledCommand<MoveItemFromShowCaseToPlayerTS>();
     return cmd;
 }
 
@@ -989,7 +990,7 @@ void MoveItemInsideInventoryTS::performAction(Player *player) {
 }
 
 auto MoveItemInsideInventoryTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<MoveItemInsideInventoryTS>();
+    ClientCommandPointer cmd = makePooledCommand<MoveItemInsideInventoryTS>();
     return cmd;
 }
 
@@ -1013,7 +1014,7 @@ void DropItemFromInventoryOnMapTS::performAction(Player *player) {
 }
 
 auto DropItemFromInventoryOnMapTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<DropItemFromInventoryOnMapTS>();
+    ClientCommandPointer cmd = makePooledCommand<DropItemFromInventoryOnMapTS>();
     return cmd;
 }
 
@@ -1041,7 +1042,7 @@ void MoveItemFromMapToPlayerTS::performAction(Player *player) {
 }
 
 auto MoveItemFromMapToPlayerTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<MoveItemFromMapToPlayerTS>();
+    ClientCommandPointer cmd = makePooledCommand<MoveItemFromMapToPlayerTS>();
     return cmd;
 }
 
@@ -1070,7 +1071,7 @@ void MoveItemFromMapIntoShowCaseTS::performAction(Player *player) {
 }
 
 auto MoveItemFromMapIntoShowCaseTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<MoveItemFromMapIntoShowCaseTS>();
+    ClientCommandPointer cmd = makePooledCommand<MoveItemFromMapIntoShowCaseTS>();
     return cmd;
 }
 
@@ -1099,7 +1100,7 @@ void MoveItemFromMapToMapTS::performAction(Player *player) {
 }
 
 auto MoveItemFromMapToMapTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<MoveItemFromMapToMapTS>();
+    ClientCommandPointer cmd = makePooledCommand<MoveItemFromMapToMapTS>();
     return cmd;
 }
 
@@ -1126,7 +1127,7 @@ void MoveItemBetweenShowCasesTS::performAction(Player *player) {
 }
 
 auto MoveItemBetweenShowCasesTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<MoveItemBetweenShowCasesTS>();
+    ClientCommandPointer cmd = makePooledCommand<MoveItemBetweenShowCasesTS>();
     return cmd;
 }
 
@@ -1151,7 +1152,7 @@ void DropItemFromShowCaseOnMapTS::performAction(Player *player) {
 }
 
 auto DropItemFromShowCaseOnMapTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<DropItemFromShowCaseOnMapTS>();
+    ClientCommandPointer cmd = makePooledCommand<DropItemFromShowCaseOnMapTS>();
     return cmd;
 }
 
@@ -1170,7 +1171,7 @@ void CloseContainerInShowCaseTS::performAction(Player *player) {
 }
 
 auto CloseContainerInShowCaseTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<CloseContainerInShowCaseTS>();
+    ClientCommandPointer cmd = makePooledCommand<CloseContainerInShowCaseTS>();
     return cmd;
 }
 
@@ -1191,7 +1192,7 @@ void LookIntoShowCaseContainerTS::performAction(Player *player) {
 }
 
 auto LookIntoShowCaseContainerTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<LookIntoShowCaseContainerTS>();
+    ClientCommandPointer cmd = makePooledCommand<LookIntoShowCaseContainerTS>();
     return cmd;
 }
 
@@ -1208,7 +1209,7 @@ void LookIntoInventoryTS::performAction(Player *player) {
 }
 
 auto LookIntoInventoryTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<LookIntoInventoryTS>();
+    ClientCommandPointer cmd = makePooledCommand<LookIntoInventoryTS>();
     return cmd;
 }
 
@@ -1229,7 +1230,7 @@ void LookIntoContainerOnFieldTS::performAction(Player *player) {
 }
 
 auto LookIntoContainerOnFieldTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<LookIntoContainerOnFieldTS>();
+    ClientCommandPointer cmd = makePooledCommand<LookIntoContainerOnFieldTS>();
     return cmd;
 }
 
@@ -1253,7 +1254,7 @@ void PickUpItemTS::performAction(Player *player) {
 }
 
 auto PickUpItemTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<PickUpItemTS>();
+    ClientCommandPointer cmd = makePooledCommand<PickUpItemTS>();
     return cmd;
 }
 
@@ -1273,7 +1274,7 @@ void PickUpAllItemsTS::performAction(Player *player) {
 }
 
 auto PickUpAllItemsTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<PickUpAllItemsTS>();
+    ClientCommandPointer cmd = makePooledCommand<PickUpAllItemsTS>();
     return cmd;
 }
 
@@ -1288,7 +1289,7 @@ void LogOutTS::performAction(Player *player) {
 }
 
 auto LogOutTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<LogOutTS>();
+    ClientCommandPointer cmd = makePooledCommand<LogOutTS>();
     return cmd;
 }
 
@@ -1303,7 +1304,7 @@ void WhisperTS::performAction(Player *player) {
 }
 
 auto WhisperTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<WhisperTS>();
+    ClientCommandPointer cmd = makePooledCommand<WhisperTS>();
     return cmd;
 }
 
@@ -1317,7 +1318,7 @@ void ShoutTS::performAction(Player *player) {
 }
 
 auto ShoutTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<ShoutTS>();
+    ClientCommandPointer cmd = makePooledCommand<ShoutTS>();
     return cmd;
 }
 
@@ -1337,7 +1338,7 @@ void SayTS::performAction(Player *player) {
 }
 
 auto SayTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<SayTS>();
+    ClientCommandPointer cmd = makePooledCommand<SayTS>();
     return cmd;
 }
 
@@ -1352,7 +1353,7 @@ void RefreshTS::performAction(Player *player) {
 }
 
 auto RefreshTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<RefreshTS>();
+    ClientCommandPointer cmd = makePooledCommand<RefreshTS>();
     return cmd;
 }
 
@@ -1370,7 +1371,7 @@ void IntroduceTS::performAction(Player *player) {
 }
 
 auto IntroduceTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<IntroduceTS>();
+    ClientCommandPointer cmd = makePooledCommand<IntroduceTS>();
     return cmd;
 }
 
@@ -1389,7 +1390,7 @@ void CustomNameTS::performAction(Player *player) {
 }
 
 auto CustomNameTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<CustomNameTS>();
+    ClientCommandPointer cmd = makePooledCommand<CustomNameTS>();
     return cmd;
 }
 
@@ -1426,7 +1427,7 @@ void AttackPlayerTS::performAction(Player *player) {
 }
 
 auto AttackPlayerTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<AttackPlayerTS>();
+    ClientCommandPointer cmd = makePooledCommand<AttackPlayerTS>();
     return cmd;
 }
 
@@ -1449,7 +1450,7 @@ void LookAtMapItemTS::performAction(Player *player) {
 }
 
 auto LookAtMapItemTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<LookAtMapItemTS>();
+    ClientCommandPointer cmd = makePooledCommand<LookAtMapItemTS>();
     return cmd;
 }
 
@@ -1466,7 +1467,7 @@ void PlayerSpinTS::performAction(Player *player) {
 }
 
 auto PlayerSpinTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<PlayerSpinTS>();
+    ClientCommandPointer cmd = makePooledCommand<PlayerSpinTS>();
     return cmd;
 }
 
@@ -1498,7 +1499,7 @@ void CharMoveTS::performAction(Player *player) {
 }
 
 auto CharMoveTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<CharMoveTS>();
+    ClientCommandPointer cmd = makePooledCommand<CharMoveTS>();
     return cmd;
 }
 
@@ -1513,7 +1514,7 @@ void LoginCommandTS::decodeData() {
 void LoginCommandTS::performAction(Player *player) { time(&(player->lastaction)); }
 
 auto LoginCommandTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<LoginCommandTS>();
+    ClientCommandPointer cmd = makePooledCommand<LoginCommandTS>();
     return cmd;
 }
 
@@ -1540,6 +1541,6 @@ void ScreenSizeCommandTS::performAction(Player *player) {
 }
 
 auto ScreenSizeCommandTS::clone() -> ClientCommandPointer {
-    ClientCommandPointer cmd = std::make_shared<ScreenSizeCommandTS>();
+    ClientCommandPointer cmd = makePooledCommand<ScreenSizeCommandTS>();
     return cmd;
 }
@@ -34,8 +34,14 @@
 #include "netinterface/BasicServerCommand.hpp"
 #include "netinterface/NetInterface.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <mutex>
 #include <range/v3/all.hpp>
+#include <stdexcept>
+#include <vector>
+#include <zlib.h>
 
 KeepAliveTC::KeepAliveTC() : BasicServerCommand(SC_KEEPALIVE_TC) {}
 
@@ -202,6 +208,15 @@ CloseDialogTC::CloseDialogTC(unsigned int dialogId) : BasicServerCommand(SC_CLOS
     addIntToBuffer(static_cast<int>(dialogId));
 }
 
+// packs all three coordinates without loss, so different fields never share a coalescing key
+auto positionKey(const position &pos) -> uint64_t {
+    constexpr auto coordinateBits = 16;
+    const auto x = static_cast<uint16_t>(pos.x);
+    const auto y = static_cast<uint16_t>(pos.y);
+    const auto z = static_cast<uint16_t>(pos.z);
+    return (uint64_t{x} << 2 * coordinateBits) | (uint64_t{y} << coordinateBits) | z;
+}
+
 void addMovementCostToBuffer(BasicServerCommand *cmd, const position &pos) {
     try {
         map::Field &field = World::get()->fieldAt(pos);
@@ -213,6 +228,7 @@ void addMovementCostToBuffer(BasicServerCommand *cmd, const position &pos) {
 
 ItemUpdate_TC::ItemUpdate_TC(const position &pos, const std::vector<Item> &items)
         : BasicServerCommand(SC_ITEMUPDATE_TC) {
+    setCoalescingKey(positionKey(pos));
     Logger::debug(LogFacility::World) << "sending new itemstack for pos " << pos << Log::end;
     addShortIntToBuffer(pos.x);
     addShortIntToBuffer(pos.y);
@@ -501,6 +517,9 @@ MapStripeTC::MapStripeTC(const position &pos, NewClientView::stripedirection dir
     addUnsignedCharToBuffer(static_cast<unsigned char>(dir));
     const auto &fields = World::get()->clientview.mapStripe;
     const uint8_t numberOfTiles = World::get()->clientview.getMaxTiles();
+    constexpr auto stripeHeaderSize = 8;
+    constexpr auto emptyFieldSize = 6;
+    reserveData(stripeHeaderSize + numberOfTiles * emptyFieldSize);
     addUnsignedCharToBuffer(numberOfTiles);
 
     ranges::for_each(fields | ranges::view::take(numberOfTiles), [&](const auto &field) {
@@ -528,10 +547,61 @@ MapStripeTC::MapStripeTC(const position &pos, NewClientView::stripedirection dir
     });
 }
 
+namespace {
+std::atomic<uint64_t> compressedCommands = 0;
+std::atomic<uint64_t> uncompressedBytes = 0;
+std::atomic<uint64_t> compressedBytes = 0;
+// guards the compressed copy cached in shared commands
+std::mutex compressionMutex;
+} // namespace
+
+CompressedTC::CompressedTC(const BasicServerCommand &command, const char *compressed, size_t compressedLength)
+        : BasicServerCommand(SC_COMPRESSED_TC) {
+    copyCoalescingKey(command);
+    reserveData(sizeof(int32_t) + compressedLength);
+    addIntToBuffer(command.getLength());
+    addBytesToBuffer(compressed, compressedLength);
+}
+
+auto CompressedTC::compress(const ServerCommandPointer &command) -> ServerCommandPointer {
+    std::lock_guard<std::mutex> lock(compressionMutex);
+
+    // shared commands are compressed once for all their receivers
+    if (!command->compressionTried) {
+        command->compressionTried = true;
+        const auto length = command->getLength();
+        // the frame must end up smaller than the original, zlib gives up as soon as the output exceeds that
+        constexpr auto frameOverhead = static_cast<int>(headerSize + sizeof(int32_t) + 1);
+        uLongf compressedLength = std::max(length - frameOverhead, 0);
+        std::vector<Bytef> compressed(compressedLength);
+
+        if (compressedLength > 0 &&
+            compress2(compressed.data(), &compressedLength, reinterpret_cast<const Bytef *>(command->cmdData()),
+                      length, Z_BEST_SPEED) == Z_OK) {
+            auto frame = std::make_shared<CompressedTC>(*command, reinterpret_cast<const char *>(compressed.data()),
+                                                        compressedLength);
+            frame->addHeader();
+            ++compressedCommands;
+            uncompressedBytes += length;
+            compressedBytes += frame->getLength();
+            command->compressedCommand = std::move(frame);
+        }
+    }
+
+    return command->compressedCommand ? command->compressedCommand : command;
+}
+
+auto CompressedTC::getStats() -> Stats { return {compressedCommands, uncompressedBytes, compressedBytes}; }
+
 MapCompleteTC::MapCompleteTC() : BasicServerCommand(SC_MAPCOMPLETE_TC) {}
 
-MoveAckTC::MoveAckTC(TYPE_OF_CHARACTER_ID id, const position &pos, unsigned char mode, TYPE_OF_WALKINGCOST duration)
+MoveAckTC::MoveAckTC(TYPE_OF_CHARACTER_ID id, const position &pos, unsigned char mode, TYPE_OF_WALKINGCOST duration,
+                     bool otherCharacter)
         : BasicServerCommand(SC_MOVEACK_TC) {
+    if (otherCharacter) {
+        setCoalescingKey(id);
+    }
+
     addIntToBuffer(id);
     addShortIntToBuffer(pos.x);
     addShortIntToBuffer(pos.y);
@@ -577,6 +647,11 @@ MusicDefaultTC::MusicDefaultTC() : BasicServerCommand(SC_MUSICDEFAULT_TC) {}
 
 UpdateAttribTC::UpdateAttribTC(TYPE_OF_CHARACTER_ID id, const std::string &name, unsigned short int value)
         : BasicServerCommand(SC_UPDATEATTRIB_TC) {
+    if (const auto attribute = Character::attributeMap.find(name); attribute != Character::attributeMap.end()) {
+        constexpr auto attributeBits = 8;
+        setCoalescingKey((uint64_t{id} << attributeBits) | attribute->second);
+    }
+
     addIntToBuffer(id);
     addStringToBuffer(name);
     addShortIntToBuffer(static_cast<short>(value));
@@ -26,6 +26,7 @@
 #include "NewClientView.hpp"
 #include "netinterface/BasicServerCommand.hpp"
 
+#include <cstdint>
 #include <vector>
 
 struct WeatherStruct;
@@ -39,6 +40,7 @@ enum ServerCommands {
     SC_SETCOORDINATE_TC = 0xBD,
     SC_MAPSTRIPE_TC = 0xA1,
     SC_MAPCOMPLETE_TC = 0xA2,
+    SC_COMPRESSED_TC = 0xA3,
     SC_PLAYERSPIN_TC = 0xE0,
     SC_UPDATEINVENTORYPOS_TC = 0xC1,
     SC_CLEARSHOWCASE_TC = 0xC4,
@@ -288,6 +290,30 @@ public:
     MapStripeTC(const position &pos, NewClientView::stripedirection dir);
 };
 
+/**
+ * Wraps another, already finalized command in a zlib compressed frame. The payload consists of the length of the
+ * wrapped command followed by the compressed bytes of that command including its own header.
+ */
+class CompressedTC : public BasicServerCommand {
+public:
+    CompressedTC(const BasicServerCommand &command, const char *compressed, size_t compressedLength);
+
+    /**
+     * Compresses a command if that makes it smaller, the result is kept in the command for its other receivers
+     * @param command The finalized command
+     * @return The compressed command or the original one if compression did not pay off
+     */
+    static auto compress(const ServerCommandPointer &command) -> ServerCommandPointer;
+
+    struct Stats {
+        uint64_t commands;
+        uint64_t uncompressedBytes;
+        uint64_t compressedBytes;
+    };
+
+    static auto getStats() -> Stats;
+};
+
 class MapCompleteTC : public BasicServerCommand {
 public:
     MapCompleteTC();
@@ -295,7 +321,9 @@ public:
 
 class MoveAckTC : public BasicServerCommand {
 public:
-    MoveAckTC(TYPE_OF_CHARACTER_ID id, const position &pos, unsigned char mode, TYPE_OF_WALKINGCOST duration);
+    // only moves of other characters may replace each other in a send queue, a player needs every ack of their own
+    MoveAckTC(TYPE_OF_CHARACTER_ID id, const position &pos, unsigned char mode, TYPE_OF_WALKINGCOST duration,
+              bool otherCharacter = false);
 };
 
 class IntroduceTC : public BasicServerCommand {
@@ -0,0 +1,185 @@
+/*
+ *  illarionserver - server for the game Illarion
+ *  Copyright 2011 Illarion e.V.
+ *
+ *  This file is part of illarionserver.
+ *
+ *  illarionserver is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  illarionserver is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with illarionserver.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LuaAllocator.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+auto LuaAllocator::allocate(void *userData, void *ptr, size_t oldSize, size_t newSize) -> void * {
+    return static_cast<LuaAllocator *>(userData)->reallocate(ptr, oldSize, newSize);
+}
+
+auto LuaAllocator::reallocate(void *ptr, size_t oldSize, size_t newSize) -> void * {
+    if (ptr == nullptr) {
+        // for new blocks Lua passes the object type instead of a size
+        oldSize = 0;
+    }
+
+    const auto oldClass = ptr != nullptr ? blockClassOf(ptr, oldSize) : largeBlock;
+
+    if (newSize == 0) {
+        if (ptr != nullptr) {
+            release(ptr, oldClass);
+            usage -= oldSize;
+        }
+
+        return nullptr;
+    }
+
+    if (limit > 0 && newSize > oldSize && usage + (newSize - oldSize) > limit) {
+        ++failedAllocations;
+        return nullptr;
+    }
+
+    const auto newClass = sizeClassOf(newSize);
+    void *result = nullptr;
+
+    if (ptr != nullptr && oldClass == newClass) {
+        result = newClass == largeBlock ? std::realloc(ptr, newSize) : ptr;
+
+        if (result != nullptr && !keptClasses.empty()) {
+            std::erase_if(keptClasses, [ptr](const auto &kept) { return kept.first == ptr; });
+        }
+    } else {
+        result = acquire(newClass, newSize);
+
+        if (result != nullptr && ptr != nullptr) {
+            std::memcpy(result, ptr, std::min(oldSize, newSize));
+            release(ptr, oldClass);
+        }
+    }
+
+    if (result == nullptr && ptr != nullptr && newSize <= oldSize) {
+        // Lua expects shrinking to succeed, so the block stays in its class and is remembered there
+        try {
+            const bool known = std::any_of(keptClasses.begin(), keptClasses.end(),
+                                           [ptr](const auto &kept) { return kept.first == ptr; });
+
+            if (oldClass != newClass && !known) {
+                keptClasses.emplace_back(ptr, oldClass);
+            }
+
+            result = ptr;
+        } catch (std::bad_alloc &) {
+        }
+    }
+
+    if (result == nullptr) {
+        ++failedAllocations;
+        return nullptr;
+    }
+
+    usage = usage - oldSize + newSize;
+    return result;
+}
+
+auto LuaAllocator::getSizeClassStats() const -> std::vector<SizeClassStats> {
+    std::vector<SizeClassStats> stats;
+    stats.reserve(sizeClasses.size());
+
+    for (size_t i = 0; i < sizeClasses.size(); ++i) {
+        const auto &pool = pools[i];
+        stats.push_back({sizeClasses[i], pool.blocksInUse, pool.blocksReserved, pool.allocations});
+    }
+
+    return stats;
+}
+
+auto LuaAllocator::sizeClassOf(size_t size) -> size_t {
+    const auto sizeClass = std::lower_bound(sizeClasses.begin(), sizeClasses.end(), size);
+    return static_cast<size_t>(sizeClass - sizeClasses.begin());
+}
+
+auto LuaAllocator::blockClassOf(void *ptr, size_t size) const -> size_t {
+    for (const auto &[block, sizeClass] : keptClasses) {
+        if (block == ptr) {
+            return sizeClass;
+        }
+    }
+
+    return sizeClassOf(size);
+}
+
+auto LuaAllocator::acquire(size_t sizeClass, size_t size) -> void * {
+    if (sizeClass == largeBlock) {
+        void *block = std::malloc(size);
+
+        if (block != nullptr) {
+            ++largeBlocks;
+        }
+
+        return block;
+    }
+
+    auto &pool = pools[sizeClass];
+
+    if (pool.freeList == nullptr && !refill(sizeClass)) {
+        return nullptr;
+    }
+
+    auto *block = pool.freeList;
+    pool.freeList = block->next;
+    ++pool.blocksInUse;
+    ++pool.allocations;
+    return block;
+}
+
+void LuaAllocator::release(void *ptr, size_t sizeClass) {
+    if (!keptClasses.empty()) {
+        std::erase_if(keptClasses, [ptr](const auto &kept) { return kept.first == ptr; });
+    }
+
+    if (sizeClass == largeBlock) {
+        std::free(ptr);
+        --largeBlocks;
+        return;
+    }
+
+    auto &pool = pools[sizeClass];
+    auto *block = static_cast<FreeBlock *>(ptr);
+    block->next = pool.freeList;
+    pool.freeList = block;
+    --pool.blocksInUse;
+}
+
+auto LuaAllocator::refill(size_t sizeClass) -> bool {
+    std::unique_ptr<std::byte[]> slab{new (std::nothrow) std::byte[slabSize]};
+
+    if (!slab) {
+        return false;
+    }
+
+    auto &pool = pools[sizeClass];
+    const auto blockSize = sizeClasses[sizeClass];
+    const auto blocks = slabSize / blockSize;
+
+    for (size_t i = blocks; i > 0; --i) {
+        auto *block = reinterpret_cast<FreeBlock *>(slab.get() + (i - 1) * blockSize);
+        block->next = pool.freeList;
+        pool.freeList = block;
+    }
+
+    pool.blocksReserved += blocks;
+    slabs.push_back(std::move(slab));
+    return true;
+}
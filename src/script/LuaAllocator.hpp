@@ -0,0 +1,97 @@
+/*
+ *  illarionserver - server for the game Illarion
+ *  Copyright 2011 Illarion e.V.
+ *
+ *  This file is part of illarionserver.
+ *
+ *  illarionserver is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  illarionserver is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with illarionserver.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUA_ALLOCATOR_HPP
+#define LUA_ALLOCATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Allocator for the Lua state. Small blocks are served from per size class
+// free lists carved out of larger slabs, everything else goes to malloc.
+class LuaAllocator {
+public:
+    static constexpr std::array<size_t, 8> sizeClasses = {16, 32, 48, 64, 96, 128, 192, 256};
+    static constexpr size_t slabSize = 64 * 1024;
+
+    struct SizeClassStats {
+        size_t blockSize = 0;
+        size_t blocksInUse = 0;
+        size_t blocksReserved = 0;
+        uint64_t allocations = 0;
+    };
+
+    LuaAllocator() { keptClasses.reserve(keptClassesReserve); }
+    LuaAllocator(const LuaAllocator &) = delete;
+    auto operator=(const LuaAllocator &) -> LuaAllocator & = delete;
+    LuaAllocator(LuaAllocator &&) = delete;
+    auto operator=(LuaAllocator &&) -> LuaAllocator & = delete;
+    ~LuaAllocator() = default;
+
+    // lua_Alloc entry point, userData has to point to a LuaAllocator
+    static auto allocate(void *userData, void *ptr, size_t oldSize, size_t newSize) -> void *;
+
+    auto reallocate(void *ptr, size_t oldSize, size_t newSize) -> void *;
+
+    // maximum number of bytes handed out to Lua, 0 disables the limit
+    void setLimit(size_t bytes) { limit = bytes; }
+    [[nodiscard]] auto getLimit() const -> size_t { return limit; }
+    [[nodiscard]] auto getUsage() const -> size_t { return usage; }
+    [[nodiscard]] auto getLargeBlocks() const -> size_t { return largeBlocks; }
+    [[nodiscard]] auto getFailedAllocations() const -> uint64_t { return failedAllocations; }
+    [[nodiscard]] auto getSizeClassStats() const -> std::vector<SizeClassStats>;
+
+private:
+    static constexpr size_t largeBlock = sizeClasses.size();
+    // room for blocks kept in place by failed shrinks, reserved up front since they happen when memory runs out
+    static constexpr size_t keptClassesReserve = 64;
+
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    struct Pool {
+        FreeBlock *freeList = nullptr;
+        size_t blocksInUse = 0;
+        size_t blocksReserved = 0;
+        uint64_t allocations = 0;
+    };
+
+    static auto sizeClassOf(size_t size) -> size_t;
+    auto blockClassOf(void *ptr, size_t size) const -> size_t;
+    auto acquire(size_t sizeClass, size_t size) -> void *;
+    void release(void *ptr, size_t sizeClass);
+    auto refill(size_t sizeClass) -> bool;
+
+    std::array<Pool, sizeClasses.size()> pools;
+    std::vector<std::unique_ptr<std::byte[]>> slabs;
+    // blocks whose size class is larger than the size Lua knows them by
+    std::vector<std::pair<void *, size_t>> keptClasses;
+    size_t usage = 0;
+    size_t limit = 0;
+    size_t largeBlocks = 0;
+    uint64_t failedAllocations = 0;
+};
+
+#endif
@@ -34,6 +34,7 @@ extern "C" {
 #include "data/Data.hpp"
 #include "script/binding/binding.hpp"
 #include "script/forwarder.hpp"
+#include "tuningConstants.hpp"
 
 #include <algorithm>
 #include <boost/algorithm/string.hpp>
@@ -42,7 +43,11 @@ extern "C" {
 #include <luabind/raw_policy.hpp>
 
 lua_State *LuaScript::_luaState = nullptr;
+LuaAllocator LuaScript::allocator;
 bool LuaScript::initialized = false;
+std::chrono::nanoseconds LuaScript::gcTime = std::chrono::nanoseconds::zero();
+size_t LuaScript::gcBaseline = 0;
+bool LuaScript::gcCycleRunning = false;
 
 LuaScript::LuaScript() { initialize(); }
 
@@ -74,9 +79,17 @@ LuaScript::LuaScript(const std::string &code, const std::string &scriptname) {
 void LuaScript::initialize() {
     if (!initialized) {
         initialized = true;
-        _luaState = luaL_newstate();
+        constexpr size_t bytesPerMegabyte = 1024 * 1024;
+        allocator.setLimit(static_cast<size_t>(Config::instance().lua_memory_limit()) * bytesPerMegabyte);
+        _luaState = lua_newstate(LuaAllocator::allocate, &allocator);
+        lua_atpanic(_luaState, LuaScript::panic);
         luabind::open(_luaState);
 
+        // most collection work is done in idle time, the automatic collector
+        // only has to step in when the server is busy for a long time
+        lua_gc(_luaState, LUA_GCSETPAUSE, luaGarbageCollectionPause);
+        lua_gc(_luaState, LUA_GCSETSTEPMUL, luaGarbageCollectionStepMultiplier);
+
         // use another error function to surpress errors from
         // non-existant entry points and to display a backtrace
         luabind::set_pcall_callback(LuaScript::add_backtrace);
@@ -165,7 +178,54 @@ void LuaScript::shutdownLua() {
         initialized = false;
         lua_close(_luaState);
         _luaState = nullptr;
+        gcBaseline = 0;
+        gcCycleRunning = false;
+    }
+}
+
+void LuaScript::collectGarbage(std::chrono::nanoseconds budget) {
+    if (!initialized) {
+        return;
+    }
+
+    using std::chrono::steady_clock;
+
+    if (!gcCycleRunning) {
+        if (getMemoryUsage() < gcBaseline * luaIdleCollectionThreshold) {
+            return;
+        }
+
+        gcCycleRunning = true;
     }
+
+    const auto start = steady_clock::now();
+    const auto deadline = start + budget;
+
+    do {
+        if (lua_gc(_luaState, LUA_GCSTEP, 0) != 0) {
+            gcCycleRunning = false;
+            gcBaseline = getMemoryUsage();
+        }
+    } while (gcCycleRunning && steady_clock::now() < deadline);
+
+    gcTime += steady_clock::now() - start;
+}
+
+auto LuaScript::getMemoryUsage() -> size_t {
+    if (!initialized) {
+        return 0;
+    }
+
+    constexpr size_t bytesPerKilobyte = 1024;
+    return static_cast<size_t>(lua_gc(_luaState, LUA_GCCOUNT, 0)) * bytesPerKilobyte +
+           static_cast<size_t>(lua_gc(_luaState, LUA_GCCOUNTB, 0));
+}
+
+auto LuaScript::panic(lua_State *L) -> int {
+    const char *message = lua_tostring(L, -1);
+    Logger::alert(LogFacility::Script) << "Unprotected error in Lua: " << (message != nullptr ? message : "unknown")
+                                       << Log::end;
+    return 0;
 }
 
 auto LuaScript::add_backtrace(lua_State *L) -> int {
@@ -27,6 +27,7 @@ extern "C" {
 
 #include "Item.hpp"
 #include "Logger.hpp"
+#include "LuaAllocator.hpp"
 #include "character_ptr.hpp"
 #include "globals.hpp"
 
@@ -60,6 +61,14 @@ public:
 
     static auto getLuaState() -> lua_State * { return _luaState; }
 
+    // run incremental collection steps until the cycle finishes or the budget is used up
+    static void collectGarbage(std::chrono::nanoseconds budget);
+    // bytes currently allocated by the Lua state
+    [[nodiscard]] static auto getMemoryUsage() -> size_t;
+    static auto getAllocator() -> const LuaAllocator & { return allocator; }
+    // time spent in collectGarbage, automatic steps during script calls are not included
+    [[nodiscard]] static auto getGarbageCollectionTime() -> std::chrono::nanoseconds { return gcTime; }
+
     static void shutdownLua();
     [[nodiscard]] auto existsEntrypoint(const std::string &entrypoint) const -> bool;
     void addQuestScript(const std::string &entrypoint, const std::shared_ptr<LuaScript> &script);
@@ -110,7 +119,11 @@ public:
 
 protected:
     static lua_State *_luaState;
+    static LuaAllocator allocator;
     static bool initialized;
+    static std::chrono::nanoseconds gcTime;
+    static size_t gcBaseline;
+    static bool gcCycleRunning;
 
     template <typename... Args> void callEntrypoint(const std::string &entrypoint, const Args &...args) {
         setCurrentWorldScript();
@@ -133,6 +146,7 @@ private:
     void handleLuaCallError(int errorCode);
     static void init_base_functions();
     static auto add_backtrace(lua_State *L) -> int;
+    static auto panic(lua_State *L) -> int;
     static void writeErrorMsg();
     void writeCastErrorMsg(const std::string &entryPoint, const luabind::cast_failed &e) const;
     void checkRunTime(const std::string &entryPoint, const std::chrono::nanoseconds duration) const;
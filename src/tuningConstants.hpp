@@ -28,10 +28,19 @@ using namespace std::chrono_literals;
 constexpr auto reduceMentalCapacityInterval = 10s;
 constexpr auto checkMonitoringClientsInterval = 250ms;
 constexpr auto scheduledScriptsInterval = 100ms;
+constexpr auto scheduledScriptsTimeBudget = 20ms;
 constexpr auto wearReductionInterval = 3min;
 constexpr auto gameLoopInterval = 100ms;
 constexpr auto scriptRunTimeLimitSoft = 250ms; //Upping this from 20ms to 250ms because it spams the living crap out of the devserver log at 20ms, which is a real nuisance
 constexpr auto ingameTimeUpdateInterval = 8h;
+constexpr auto questProgressFlushInterval = 5s;
+constexpr auto scriptVariablesFlushInterval = 1min;
+constexpr auto onlinePlayerListInterval = 1s;
+constexpr auto onlinePlayerListReconcileInterval = 10min;
+constexpr auto luaGarbageCollectionSlice = 2ms;
+constexpr auto luaGarbageCollectionPause = 250;
+constexpr auto luaGarbageCollectionStepMultiplier = 200;
+constexpr double luaIdleCollectionThreshold = 1.3;
 
 constexpr auto PLAYER_SAVE_INTERVAL = 60;
 constexpr auto CLIENT_TIMEOUT = 50;
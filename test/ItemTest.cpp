@@ -184,6 +184,35 @@ TEST(ItemTest, hasDataMultiple) {
     EXPECT_FALSE(item.hasData( {std::make_pair("testKey", "testValue"), std::make_pair("wrongKey", "wrongValue")}));
 }
 
+TEST(ItemTest, copyKeepsData) {
+    Item item;
+    item.setData("testKey", "testValue");
+    Item copy = item;
+    EXPECT_EQ("testValue", copy.getData("testKey"));
+    EXPECT_TRUE(copy.equalData(item));
+}
+
+TEST(ItemTest, setDataOnCopy) {
+    Item item;
+    item.setData("testKey", "testValueA");
+    Item copy = item;
+    copy.setData("testKey", "testValueB");
+    copy.setData("testKey2", "testValue2");
+    EXPECT_EQ("testValueA", item.getData("testKey"));
+    EXPECT_EQ("", item.getData("testKey2"));
+    EXPECT_EQ("testValueB", copy.getData("testKey"));
+    EXPECT_FALSE(copy.equalData(item));
+}
+
+TEST(ItemTest, clearDataOnCopy) {
+    Item item;
+    item.setData("testKey", "testValue");
+    Item copy = item;
+    copy.setData(nullptr);
+    EXPECT_TRUE(copy.hasNoData());
+    EXPECT_EQ("testValue", item.getData("testKey"));
+}
+
 auto main(int argc, char **argv) -> int {
     ::testing::InitGoogleTest(&argc, argv);
     ::testing::AddGlobalTestEnvironment(new ItemEnvironment);
@@ -0,0 +1,103 @@
+#include "script/LuaAllocator.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <new>
+
+namespace {
+bool failSlabAllocation = false;
+}
+
+// lets the tests run the allocator out of slabs
+auto operator new[](size_t size, const std::nothrow_t & /*unused*/) noexcept -> void * {
+    if (failSlabAllocation) {
+        return nullptr;
+    }
+
+    return std::malloc(size);
+}
+
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+
+TEST(lua_allocator_tests, small_blocks_are_pooled) {
+    LuaAllocator allocator;
+    void *block = allocator.reallocate(nullptr, 0, 20);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(allocator.getUsage(), 20);
+
+    const auto stats = allocator.getSizeClassStats();
+    EXPECT_EQ(stats[1].blockSize, 32);
+    EXPECT_EQ(stats[1].blocksInUse, 1);
+    EXPECT_EQ(stats[1].allocations, 1);
+    EXPECT_EQ(stats[1].blocksReserved, LuaAllocator::slabSize / 32);
+
+    EXPECT_EQ(allocator.reallocate(block, 20, 0), nullptr);
+    EXPECT_EQ(allocator.getUsage(), 0);
+    EXPECT_EQ(allocator.getSizeClassStats()[1].blocksInUse, 0);
+    EXPECT_EQ(allocator.reallocate(nullptr, 0, 30), block);
+}
+
+TEST(lua_allocator_tests, reallocation_keeps_content) {
+    LuaAllocator allocator;
+    auto *block = static_cast<char *>(allocator.reallocate(nullptr, 0, 8));
+    std::strcpy(block, "illarion");
+
+    block = static_cast<char *>(allocator.reallocate(block, 8, 1000));
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(std::strncmp(block, "illarion", 8), 0);
+    EXPECT_EQ(allocator.getLargeBlocks(), 1);
+
+    block = static_cast<char *>(allocator.reallocate(block, 1000, 100));
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(std::strncmp(block, "illarion", 8), 0);
+    EXPECT_EQ(allocator.getLargeBlocks(), 0);
+    EXPECT_EQ(allocator.getUsage(), 100);
+
+    allocator.reallocate(block, 100, 0);
+}
+
+TEST(lua_allocator_tests, limit_is_enforced) {
+    LuaAllocator allocator;
+    allocator.setLimit(100);
+    void *block = allocator.reallocate(nullptr, 0, 80);
+    ASSERT_NE(block, nullptr);
+
+    EXPECT_EQ(allocator.reallocate(nullptr, 0, 40), nullptr);
+    EXPECT_EQ(allocator.reallocate(block, 80, 200), nullptr);
+    EXPECT_EQ(allocator.getFailedAllocations(), 2);
+
+    void *shrunk = allocator.reallocate(block, 80, 10);
+    ASSERT_NE(shrunk, nullptr);
+    EXPECT_EQ(allocator.getUsage(), 10);
+
+    allocator.reallocate(shrunk, 10, 0);
+}
+
+TEST(lua_allocator_tests, failed_shrink_keeps_block) {
+    LuaAllocator allocator;
+    void *block = allocator.reallocate(nullptr, 0, 100);
+    ASSERT_NE(block, nullptr);
+
+    failSlabAllocation = true;
+    EXPECT_EQ(allocator.reallocate(block, 100, 40), block);
+    EXPECT_EQ(allocator.reallocate(nullptr, 0, 40), nullptr);
+    failSlabAllocation = false;
+
+    EXPECT_EQ(allocator.getUsage(), 40);
+    EXPECT_EQ(allocator.getFailedAllocations(), 1);
+    EXPECT_EQ(allocator.getSizeClassStats()[5].blocksInUse, 1);
+    EXPECT_EQ(allocator.getSizeClassStats()[2].blocksInUse, 0);
+
+    EXPECT_EQ(allocator.reallocate(block, 40, 120), block);
+    EXPECT_EQ(allocator.getUsage(), 120);
+
+    EXPECT_EQ(allocator.reallocate(block, 120, 0), nullptr);
+    EXPECT_EQ(allocator.getUsage(), 0);
+    EXPECT_EQ(allocator.getSizeClassStats()[5].blocksInUse, 0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
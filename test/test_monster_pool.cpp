@@ -0,0 +1,64 @@
+#include "Monster.hpp"
+#include "MonsterPool.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(monster_pool_tests, blocks_are_reused) {
+    const auto before = MonsterPool::getStats();
+    void *block = MonsterPool::allocate(sizeof(Monster));
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(MonsterPool::getStats().blocksInUse, before.blocksInUse + 1);
+
+    MonsterPool::deallocate(block, sizeof(Monster));
+    EXPECT_EQ(MonsterPool::getStats().blocksInUse, before.blocksInUse);
+    EXPECT_EQ(MonsterPool::allocate(sizeof(Monster)), block);
+
+    MonsterPool::deallocate(block, sizeof(Monster));
+}
+
+TEST(monster_pool_tests, spawn_kill_soak_does_not_allocate_after_reserve) {
+    constexpr size_t spawnCapacity = 50;
+    constexpr int cycles = 10000;
+    MonsterPool::reserve(spawnCapacity);
+    const auto before = MonsterPool::getStats();
+    EXPECT_GE(before.freeBlocks, spawnCapacity);
+
+    std::vector<void *> alive;
+
+    for (int cycle = 0; cycle < cycles; ++cycle) {
+        while (alive.size() < spawnCapacity) {
+            alive.push_back(MonsterPool::allocate(sizeof(Monster)));
+        }
+
+        for (size_t i = cycle % 3; i < alive.size(); i += 3) {
+            MonsterPool::deallocate(alive[i], sizeof(Monster));
+            alive[i] = nullptr;
+        }
+
+        std::erase(alive, nullptr);
+    }
+
+    const auto after = MonsterPool::getStats();
+    EXPECT_EQ(after.blockAllocations, before.blockAllocations);
+    EXPECT_GT(after.monsters, before.monsters);
+    EXPECT_LE(after.peakBlocksInUse, before.blocksInUse + spawnCapacity);
+
+    for (auto *block : alive) {
+        MonsterPool::deallocate(block, sizeof(Monster));
+    }
+}
+
+TEST(monster_pool_tests, other_sizes_are_not_pooled) {
+    const auto before = MonsterPool::getStats();
+    void *block = MonsterPool::allocate(sizeof(Monster) + 8);
+    MonsterPool::deallocate(block, sizeof(Monster) + 8);
+    const auto after = MonsterPool::getStats();
+    EXPECT_EQ(after.monsters, before.monsters);
+    EXPECT_EQ(after.freeBlocks, before.freeBlocks);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}